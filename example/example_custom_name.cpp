@@ -26,6 +26,7 @@
 
 enum class Color { RED = -10, BLUE = 0, GREEN = 10 };
 enum class Numbers { One, Two, Three };
+enum ErrorCode { ERRC_OK, ERRC_TIMEOUT };
 
 #if defined(NAMEOF_ENUM_SUPPORTED)
 // Сustom definitions of names for enum.
@@ -54,6 +55,13 @@ constexpr std::string_view nameof::customize::enum_name<Numbers>(Numbers value)
       return {}; // Empty string for default or unknown value.
   }
 }
+
+// Сustom prefix to strip from names of enum.
+// Specialization of `enum_prefix` must be injected in `namespace nameof::customize`.
+template <>
+constexpr std::string_view nameof::customize::enum_prefix<ErrorCode>() noexcept {
+  return "ERRC_";
+}
 #endif
 
 // Сustom definitions of names for type.
@@ -82,6 +90,8 @@ int main() {
   std::cout << nameof::nameof_enum(Numbers::One) << std::endl; // 'the one'
   std::cout << nameof::nameof_enum(Numbers::Two) << std::endl; // 'Two'
   std::cout << nameof::nameof_enum(Numbers::Three) << std::endl; // 'Three'
+
+  std::cout << nameof::nameof_enum(ERRC_TIMEOUT) << std::endl; // 'TIMEOUT'
 #endif
 
   std::cout << nameof::nameof_type<Color>() << std::endl; // 'The Color'
@@ -38,8 +38,10 @@
 
 #include <array>
 #include <cassert>
+#include <charconv>
 #include <cstdint>
 #include <cstddef>
+#include <functional>
 #include <iosfwd>
 #include <iterator>
 #include <limits>
@@ -53,6 +55,10 @@
 #  include <string_view>
 #endif
 
+#if __has_include(<memory_resource>)
+#  include <memory_resource>
+#endif
+
 #if __has_include(<cxxabi.h>)
 #  include <cxxabi.h>
 #  include <cstdlib>
@@ -63,6 +69,7 @@
 #  pragma clang diagnostic push
 #  pragma clang diagnostic ignored "-Wunknown-warning-option"
 #  pragma clang diagnostic ignored "-Wenum-constexpr-conversion"
+#  pragma clang diagnostic ignored "-Wundefined-var-template" // Missing definition of 'nonexist_object'.
 #elif defined(__GNUC__)
 #  pragma GCC diagnostic push
 #  pragma GCC diagnostic ignored "-Wstringop-overflow" // Missing terminating nul 'enum_name_v'.
@@ -104,6 +111,12 @@
 #  define NAMEOF_MEMBER_SUPPORTED 1
 #endif
 
+// Checks nameof_members compiler compatibility.
+#if (defined(__clang__) && __clang_major__ >= 12 || defined(__GNUC__) && __GNUC__ >= 10) && __cplusplus >= 202002L || defined(_MSC_VER) && defined(_MSVC_LANG) && _MSVC_LANG >= 202002L
+#  undef  NAMEOF_MEMBERS_SUPPORTED
+#  define NAMEOF_MEMBERS_SUPPORTED 1
+#endif
+
 // Checks nameof_pointer compiler compatibility.
 #if defined(__clang__) && __clang_major__ >= 5 || defined(__GNUC__) && __GNUC__ >= 7 || defined(_MSC_VER) && defined(_MSVC_LANG) && _MSVC_LANG >= 202002L
 #  undef  NAMEOF_POINTER_SUPPORTED
@@ -134,6 +147,12 @@
 #  define NAMEOF_ENUM_RANGE_MAX 127
 #endif
 
+// Flags of enum must be in NAMEOF_ENUM_FLAG_TABLE_MAX_BITS consecutive bits to use nameof_enum_flag_view. By default NAMEOF_ENUM_FLAG_TABLE_MAX_BITS = 8.
+// If need more bits, redefine the macro NAMEOF_ENUM_FLAG_TABLE_MAX_BITS. Table of names contains 2^bits combinations of flags.
+#if !defined(NAMEOF_ENUM_FLAG_TABLE_MAX_BITS)
+#  define NAMEOF_ENUM_FLAG_TABLE_MAX_BITS 8
+#endif
+
 namespace nameof {
 
 // If need another string_view type, define the macro NAMEOF_USING_ALIAS_STRING_VIEW.
@@ -171,6 +190,9 @@ static_assert(NAMEOF_ENUM_RANGE_MAX < (std::numeric_limits<std::int16_t>::max)()
 
 static_assert(NAMEOF_ENUM_RANGE_MAX > NAMEOF_ENUM_RANGE_MIN, "NAMEOF_ENUM_RANGE_MAX must be greater than NAMEOF_ENUM_RANGE_MIN.");
 
+static_assert(NAMEOF_ENUM_FLAG_TABLE_MAX_BITS > 0, "NAMEOF_ENUM_FLAG_TABLE_MAX_BITS must be greater than 0.");
+static_assert(NAMEOF_ENUM_FLAG_TABLE_MAX_BITS <= 10, "NAMEOF_ENUM_FLAG_TABLE_MAX_BITS must be less or equals than 10.");
+
 // If you need custom names for enum, add specialization enum_name for necessary enum type.
 template <typename E>
 constexpr string_view enum_name(E) noexcept {
@@ -178,6 +200,20 @@ constexpr string_view enum_name(E) noexcept {
   return string_view{""};
 }
 
+// If you need to strip a prefix from enum names, add specialization enum_prefix for necessary enum type.
+template <typename E>
+constexpr string_view enum_prefix() noexcept {
+  static_assert(std::is_enum_v<E>, "nameof::customize::enum_prefix requires enum type.");
+  return string_view{""};
+}
+
+// If you need to strip a suffix from enum names, add specialization enum_suffix for necessary enum type.
+template <typename E>
+constexpr string_view enum_suffix() noexcept {
+  static_assert(std::is_enum_v<E>, "nameof::customize::enum_suffix requires enum type.");
+  return string_view{""};
+}
+
 // If you need custom name for type, add specialization type_name for necessary type.
 template <typename T>
 constexpr string_view type_name() noexcept {
@@ -196,8 +232,35 @@ constexpr string_view pointer_name() noexcept {
   return string_view{""};
 }
 
+// If you need std::formatter and fmt::formatter for enum type, add specialization enum_format for necessary enum type.
+template <typename E>
+struct enum_format : std::false_type {};
+
 } // namespace nameof::customize
 
+// Styles of enum names.
+enum class style {
+  snake, // lower_snake_case
+  kebab, // lower-kebab-case
+  camel, // lowerCamelCase
+  lower, // lowercase
+  upper  // UPPERCASE
+};
+
+namespace detail {
+
+// 64-bit FNV-1a hash of string.
+constexpr std::uint64_t hash(string_view str) noexcept {
+  auto h = std::uint64_t{0xcbf29ce484222325};
+  for (std::size_t i = 0; i < str.size(); ++i) {
+    h ^= static_cast<std::uint64_t>(static_cast<unsigned char>(str[i]));
+    h *= std::uint64_t{0x100000001b3};
+  }
+  return h;
+}
+
+} // namespace nameof::detail
+
 template <std::uint16_t N>
 class [[nodiscard]] cstring {
  public:
@@ -263,8 +326,20 @@ class [[nodiscard]] cstring {
 
   [[nodiscard]] constexpr const char* c_str() const noexcept { return data(); }
 
+  [[nodiscard]] constexpr std::uint64_t hash() const noexcept { return hash_; }
+
+  template <std::uint16_t Pos, std::uint16_t Len = N - Pos>
+  [[nodiscard]] constexpr cstring<Len> substr() const noexcept {
+    static_assert(Pos <= N && Len <= N - Pos, "nameof::cstring::substr requires valid position and length.");
+    return cstring<Len>{string_view{data() + Pos, Len}};
+  }
+
   [[nodiscard]] string str() const { return {data(), size()}; }
 
+#if defined(__cpp_lib_memory_resource)
+  [[nodiscard]] std::pmr::string str(std::pmr::memory_resource* resource) const { return {data(), size(), resource}; }
+#endif
+
   [[nodiscard]] constexpr operator string_view() const& noexcept { return {data(), size()}; }
 
   [[nodiscard]] constexpr operator string_view() const&& noexcept = delete;
@@ -277,9 +352,10 @@ class [[nodiscard]] cstring {
   [[nodiscard]] static constexpr string_view check_size(string_view str) noexcept { return assert(str.size() == N), str; }
 
   template <std::uint16_t... J>
-  constexpr cstring(string_view str, std::integer_sequence<std::uint16_t, J...>) noexcept : chars_{str[J]..., '\0'} {}
+  constexpr cstring(string_view str, std::integer_sequence<std::uint16_t, J...>) noexcept : chars_{str[J]..., '\0'}, hash_{detail::hash(str)} {}
 
   char chars_[static_cast<std::size_t>(N) + 1];
+  std::uint64_t hash_;
 };
 
 template <>
@@ -341,8 +417,20 @@ class [[nodiscard]] cstring<0> {
 
   [[nodiscard]] constexpr const char* c_str() const noexcept { return chars_; }
 
+  [[nodiscard]] constexpr std::uint64_t hash() const noexcept { return detail::hash(string_view{}); }
+
+  template <std::uint16_t Pos, std::uint16_t Len = 0>
+  [[nodiscard]] constexpr cstring<0> substr() const noexcept {
+    static_assert(Pos == 0 && Len == 0, "nameof::cstring::substr requires valid position and length.");
+    return {};
+  }
+
   [[nodiscard]] string str() const { return {data(), size()}; }
 
+#if defined(__cpp_lib_memory_resource)
+  [[nodiscard]] std::pmr::string str(std::pmr::memory_resource* resource) const { return {data(), size(), resource}; }
+#endif
+
   [[nodiscard]] constexpr operator string_view() const& noexcept { return {data(), size()}; }
 
   [[nodiscard]] constexpr operator string_view() const&& noexcept = delete;
@@ -415,14 +503,83 @@ template <std::uint16_t N>
   return lhs.compare(rhs) <= 0;
 }
 
-template <typename Char, typename Traits, std::uint16_t N>
-std::basic_ostream<Char, Traits>& operator<<(std::basic_ostream<Char, Traits>& os, const cstring<N>& srt) {
-  for (const auto c : srt) {
-    os.put(c);
+namespace detail {
+
+template <std::size_t N, std::size_t M>
+constexpr auto concat(const char* lhs, const char* rhs) noexcept {
+  static_assert(N + M < (std::numeric_limits<std::uint16_t>::max)(), "nameof::cstring requires valid size.");
+  constexpr auto size = static_cast<std::uint16_t>(N + M);
+  char chars[N + M + 1] = {};
+  for (std::size_t i = 0; i < N; ++i) {
+    chars[i] = lhs[i];
+  }
+  for (std::size_t i = 0; i < M; ++i) {
+    chars[N + i] = rhs[i];
+  }
+  return cstring<size>{string_view{chars, size}};
+}
+
+// Inserts size chars to stream with a single sentry, respecting width, fill and adjustfield.
+// Chars are written by write(put), where put(string_view) writes a chunk directly to stream buffer.
+template <typename Char, typename Traits, typename F>
+std::basic_ostream<Char, Traits>& ostream_insert(std::basic_ostream<Char, Traits>& os, std::size_t size, F&& write) {
+  if (const typename std::basic_ostream<Char, Traits>::sentry guard{os}; guard) {
+    auto* buf = os.rdbuf();
+    bool ok = true;
+    const auto width = os.width() > 0 ? static_cast<std::size_t>(os.width()) : std::size_t{0};
+    const auto pad = [&, count = width > size ? width - size : std::size_t{0}]() {
+      for (std::size_t i = 0; ok && i < count; ++i) {
+        ok = !Traits::eq_int_type(buf->sputc(os.fill()), Traits::eof());
+      }
+    };
+    const auto put = [&](string_view str) {
+      if constexpr (std::is_same_v<Char, char>) {
+        ok = ok && static_cast<std::size_t>(buf->sputn(str.data(), static_cast<decltype(os.width())>(str.size()))) == str.size();
+      } else {
+        for (std::size_t i = 0; ok && i < str.size(); ++i) {
+          ok = !Traits::eq_int_type(buf->sputc(os.widen(str[i])), Traits::eof());
+        }
+      }
+    };
+
+    const bool left = (os.flags() & os.adjustfield) == os.left;
+    if (!left) {
+      pad();
+    }
+    write(put);
+    if (left) {
+      pad();
+    }
+    os.width(0);
+    if (!ok) {
+      os.setstate(os.badbit);
+    }
   }
   return os;
 }
 
+} // namespace nameof::detail
+
+template <std::uint16_t N, std::uint16_t M>
+[[nodiscard]] constexpr auto operator+(const cstring<N>& lhs, const cstring<M>& rhs) noexcept {
+  return detail::concat<N, M>(lhs.data(), rhs.data());
+}
+
+template <std::uint16_t N, std::size_t M>
+[[nodiscard]] constexpr auto operator+(const cstring<N>& lhs, const char (&rhs)[M]) noexcept {
+  return detail::concat<N, M - 1>(lhs.data(), rhs);
+}
+
+template <std::size_t N, std::uint16_t M>
+[[nodiscard]] constexpr auto operator+(const char (&lhs)[N], const cstring<M>& rhs) noexcept {
+  return detail::concat<N - 1, M>(lhs, rhs.data());
+}
+
+template <typename Char, typename Traits, std::uint16_t N>
+std::basic_ostream<Char, Traits>& operator<<(std::basic_ostream<Char, Traits>& os, const cstring<N>& srt) {
+  return detail::ostream_insert(os, srt.size(), [&srt](auto& put) { put(string_view{srt.data(), srt.size()}); });
+}
+
 namespace detail {
 
 constexpr string_view pretty_name(string_view name, bool remove_suffix = true) noexcept {
@@ -659,12 +816,45 @@ constexpr bool nv() noexcept {
   }
 }
 
+constexpr string_view strip_name(string_view name, string_view prefix, string_view suffix) noexcept {
+  const auto starts_with = [](string_view str, string_view s) constexpr noexcept {
+    if (str.size() <= s.size()) {
+      return false;
+    }
+    for (std::size_t i = 0; i < s.size(); ++i) {
+      if (str[i] != s[i]) {
+        return false;
+      }
+    }
+    return true;
+  };
+  const auto ends_with = [](string_view str, string_view s) constexpr noexcept {
+    if (str.size() <= s.size()) {
+      return false;
+    }
+    for (std::size_t i = 0; i < s.size(); ++i) {
+      if (str[str.size() - s.size() + i] != s[i]) {
+        return false;
+      }
+    }
+    return true;
+  };
+
+  if (prefix.size() > 0 && starts_with(name, prefix)) {
+    name.remove_prefix(prefix.size());
+  }
+  if (suffix.size() > 0 && ends_with(name, suffix)) {
+    name.remove_suffix(suffix.size());
+  }
+  return name;
+}
+
 template <typename E, E V>
 constexpr auto enum_name() noexcept {
   [[maybe_unused]] constexpr auto custom_name = customize::enum_name<E>(V);
 
   if constexpr (custom_name.empty()) {
-    constexpr auto name = n<E, V>();
+    constexpr auto name = strip_name(n<E, V>(), customize::enum_prefix<E>(), customize::enum_suffix<E>());
     return cstring<name.size()>{name};
   } else {
     return cstring<custom_name.size()>{custom_name};
@@ -874,165 +1064,792 @@ constexpr E enum_value(std::size_t i) noexcept {
   }
 }
 
-template <typename... T>
-struct nameof_type_supported
-#if defined(NAMEOF_TYPE_SUPPORTED) && NAMEOF_TYPE_SUPPORTED || defined(NAMEOF_TYPE_NO_CHECK_SUPPORT)
-    : std::true_type {};
-#else
-    : std::false_type {};
-#endif
+template <typename E, typename U = std::underlying_type_t<E>>
+constexpr std::size_t enum_index(E value) noexcept {
+  if constexpr (is_sparse_v<E>) {
+    for (std::size_t i = 0; i < count_v<E>; ++i) {
+      if (enum_value<E>(i) == value) {
+        return i;
+      }
+    }
+  } else {
+    const auto v = static_cast<U>(value);
+    if (v >= min_v<E> && v <= max_v<E>) {
+      return static_cast<std::size_t>(v - min_v<E>);
+    }
+  }
+  return count_v<E>; // Invalid value or out of range.
+}
 
-template <typename... T>
-struct nameof_type_rtti_supported
-#if defined(NAMEOF_TYPE_RTTI_SUPPORTED) && NAMEOF_TYPE_RTTI_SUPPORTED || defined(NAMEOF_TYPE_NO_CHECK_SUPPORT)
-    : std::true_type {};
-#else
-    : std::false_type {};
-#endif
+// Index of value in values_v by binary search, values_v is sorted. Returns count_v if value does not have a name.
+template <typename E, typename U = std::underlying_type_t<E>>
+constexpr std::size_t search_index(U value) noexcept {
+  std::size_t first = 0;
+  for (auto size = count_v<E>; size > 0;) {
+    const auto half = size / 2;
+    if (static_cast<U>(values_v<E>[first + half]) < value) {
+      first += half + 1;
+      size -= half + 1;
+    } else {
+      size = half;
+    }
+  }
+  return first < count_v<E> && static_cast<U>(values_v<E>[first]) == value ? first : count_v<E>;
+}
 
-template <typename... T>
-struct nameof_member_supported
-#if defined(NAMEOF_MEMBER_SUPPORTED) && NAMEOF_MEMBER_SUPPORTED || defined(NAMEOF_TYPE_NO_CHECK_SUPPORT)
-    : std::true_type {};
-#else
-    : std::false_type {};
-#endif
+// Checks that integer value is representable by integer type U.
+template <typename U, typename I>
+constexpr bool in_range(I value) noexcept {
+  using L = std::numeric_limits<U>;
+  if constexpr (std::is_same_v<U, bool>) {
+    return value == I{0} || value == I{1};
+  } else if constexpr (std::is_signed_v<I> == std::is_signed_v<U>) {
+    return value >= (L::min)() && value <= (L::max)();
+  } else if constexpr (std::is_signed_v<I>) {
+    return value >= I{0} && static_cast<std::make_unsigned_t<I>>(value) <= (L::max)();
+  } else {
+    return value <= static_cast<std::make_unsigned_t<U>>((L::max)());
+  }
+}
 
-template <typename... T>
-struct nameof_pointer_supported
-#if defined(NAMEOF_POINTER_SUPPORTED) && NAMEOF_POINTER_SUPPORTED || defined(NAMEOF_TYPE_NO_CHECK_SUPPORT)
-    : std::true_type {};
-#else
-    : std::false_type {};
-#endif
+// Bitset over [min_v, max_v] for sparse enum, if it is small enough, otherwise binary search over values_v.
+template <typename E>
+inline constexpr bool is_contains_bitset_v = is_sparse_v<E> && static_cast<std::size_t>(max_v<E> - min_v<E>) < 4096;
+
+template <typename E, typename U = std::underlying_type_t<E>>
+constexpr auto contains_bitset() noexcept {
+  constexpr auto size = is_contains_bitset_v<E> ? static_cast<std::size_t>(max_v<E> - min_v<E>) / 64 + 1 : 0;
+  std::array<std::uint64_t, size> bits{};
+  if constexpr (size > 0) {
+    for (std::size_t i = 0; i < count_v<E>; ++i) {
+      const auto bit = static_cast<std::size_t>(static_cast<U>(values_v<E>[i]) - min_v<E>);
+      bits[bit / 64] |= std::uint64_t{1} << (bit % 64);
+    }
+  }
+  return bits;
+}
 
-#if defined(_MSC_VER) && !defined(__clang__)
-template <typename T>
-struct identity {
-  using type = T;
-};
-#else
-template <typename T>
-using identity = T;
-#endif
+template <typename E>
+inline constexpr auto contains_bitset_v = contains_bitset<E>();
 
-template <typename T>
-using remove_cvref_t = std::remove_cv_t<std::remove_reference_t<T>>;
+template <typename E, typename U = std::underlying_type_t<E>>
+constexpr bool enum_contains(U value) noexcept {
+  if constexpr (count_v<E> == 0) {
+    return false;
+  } else {
+    if (value < min_v<E> || value > max_v<E>) {
+      return false;
+    }
+    if constexpr (!is_sparse_v<E>) {
+      return true;
+    } else if constexpr (is_contains_bitset_v<E>) {
+      const auto bit = static_cast<std::size_t>(value - min_v<E>);
+      return ((contains_bitset_v<E>[bit / 64] >> (bit % 64)) & 1) != 0;
+    } else {
+      return search_index<E>(value) < count_v<E>;
+    }
+  }
+}
 
-template <typename T, typename R>
-using enable_if_has_short_name_t = std::enable_if_t<!std::is_array_v<T> && !std::is_pointer_v<T>, R>;
+constexpr bool name_less(string_view lhs, string_view rhs) noexcept {
+  for (std::size_t i = 0; i < lhs.size() && i < rhs.size(); ++i) {
+    if (lhs[i] != rhs[i]) {
+      return static_cast<unsigned char>(lhs[i]) < static_cast<unsigned char>(rhs[i]);
+    }
+  }
+  return lhs.size() < rhs.size();
+}
 
-template <typename... T>
-constexpr auto n() noexcept {
-#if defined(_MSC_VER) && !defined(__clang__)
-  [[maybe_unused]] constexpr auto custom_name = customize::type_name<typename T::type...>();
-#else
-  [[maybe_unused]] constexpr auto custom_name = customize::type_name<T...>();
-#endif
+// Ranks of names_v in alphabetical order, equal names are ranked in order of values.
+template <typename E>
+constexpr auto name_ranks() noexcept {
+  std::array<std::uint16_t, count_v<E>> ranks{};
+  for (std::size_t i = 0; i < count_v<E>; ++i) {
+    std::size_t rank = 0;
+    for (std::size_t j = 0; j < count_v<E>; ++j) {
+      if (name_less(names_v<E>[j], names_v<E>[i]) || (j < i && !name_less(names_v<E>[i], names_v<E>[j]))) {
+        ++rank;
+      }
+    }
+    ranks[i] = static_cast<std::uint16_t>(rank);
+  }
+  return ranks;
+}
 
-  if constexpr (custom_name.empty() && nameof_type_supported<T...>::value) {
-#if defined(__clang__)
-    constexpr string_view name{__PRETTY_FUNCTION__ + 31, sizeof(__PRETTY_FUNCTION__) - 34};
-#elif defined(__GNUC__)
-    constexpr string_view name{__PRETTY_FUNCTION__ + 46, sizeof(__PRETTY_FUNCTION__) - 49};
-#elif defined(_MSC_VER)
-    constexpr string_view name{__FUNCSIG__ + 63, sizeof(__FUNCSIG__) - 81 - (__FUNCSIG__[sizeof(__FUNCSIG__) - 19] == ' ' ? 1 : 0)};
-#else
-    constexpr auto name = string_view{""};
-#endif
-    return cstring<name.size()>{name};
-  } else {
-    return cstring<custom_name.size()>{custom_name};
+template <typename E>
+inline constexpr auto name_ranks_v = name_ranks<E>();
+
+// Mask of all named flags.
+template <typename E, typename U = std::underlying_type_t<E>>
+constexpr U flags_mask() noexcept {
+  auto mask = U{0};
+  for (std::size_t i = 0; i < count_v<E, true>; ++i) {
+    if (!names_v<E, true>[i].empty()) {
+      mask |= static_cast<U>(values_v<E, true>[i]);
+    }
   }
+  return mask;
 }
 
-template <typename... T>
-inline constexpr auto type_name_v = n<T...>();
+template <typename E>
+inline constexpr auto flags_mask_v = flags_mask<E>();
 
-template <typename T>
-constexpr auto short_type_name() noexcept {
-  constexpr auto name = pretty_name(type_name_v<T>);
-  static_assert(!name.empty(), "Type does not have a short name.");
-  return cstring<name.size()>{name};
+constexpr bool is_lower(char c) noexcept {
+  return c >= 'a' && c <= 'z';
 }
 
-template <typename T>
-inline constexpr auto short_type_name_v = short_type_name<T>();
+constexpr bool is_upper(char c) noexcept {
+  return c >= 'A' && c <= 'Z';
+}
 
-template <typename T>
-string full_type_name(string name) {
-  if constexpr (std::is_const_v<std::remove_reference_t<T>>) {
-    name = string{"const "}.append(name);
-  }
-  if constexpr (std::is_volatile_v<std::remove_reference_t<T>>) {
-    name = string{"volatile "}.append(name);
-  }
-  if constexpr (std::is_lvalue_reference_v<T>) {
-    name.append(1, '&');
-  }
-  if constexpr (std::is_rvalue_reference_v<T>) {
-    name.append("&&");
-  }
-  return name;
+constexpr bool is_digit(char c) noexcept {
+  return c >= '0' && c <= '9';
 }
 
-#if __has_include(<cxxabi.h>)
-using demangle_ptr = std::unique_ptr<char, decltype(&std::free)>;
+constexpr char to_lower(char c) noexcept {
+  return is_upper(c) ? static_cast<char>(c - 'A' + 'a') : c;
+}
 
-struct demangled_name {
-  demangle_ptr p;
-  string_view v;
+constexpr char to_upper(char c) noexcept {
+  return is_lower(c) ? static_cast<char>(c - 'a' + 'A') : c;
+}
 
-  [[nodiscard]] string_view view() const noexcept { return v; }
-  [[nodiscard]] bool empty() const noexcept { return v.empty(); }
-  [[nodiscard]] string str() const { return {v.data(), v.size()}; }
-};
+// Writes name in style to out, if out is not nullptr. Returns size of styled name.
+// Words are separated by '_', lower to upper case transition and the last upper case letter before a lower case one ("HTTPServer" -> "http_server").
+template <style S>
+constexpr std::size_t styled_name(string_view name, char* out) noexcept {
+  std::size_t size = 0;
+  const auto put = [&size, out](char c) constexpr noexcept {
+    if (out != nullptr) {
+      out[size] = c;
+    }
+    ++size;
+  };
 
-inline demangled_name demangle(const char* tn) {
-  assert(tn != nullptr);
-  if (tn == nullptr) {
-    return {demangle_ptr{nullptr, &std::free}, string_view{""}};
-  }
-  int status = 0;
-  demangle_ptr p{abi::__cxa_demangle(tn, nullptr, nullptr, &status), &std::free};
-  if (status != 0) {
-    p.reset();
+  if constexpr (S == style::lower || S == style::upper) {
+    for (std::size_t i = 0; i < name.size(); ++i) {
+      put(S == style::lower ? to_lower(name[i]) : to_upper(name[i]));
+    }
+  } else {
+    bool first_word = true;
+    bool word_start = true;
+    for (std::size_t i = 0; i < name.size(); ++i) {
+      const auto c = name[i];
+      if (c == '_') {
+        word_start = true;
+        continue;
+      }
+      if (i > 0 && is_upper(c)) {
+        const auto prev = name[i - 1];
+        const bool next_lower = i + 1 < name.size() && is_lower(name[i + 1]);
+        if (is_lower(prev) || is_digit(prev) || (is_upper(prev) && next_lower)) {
+          word_start = true;
+        }
+      }
+
+      if (word_start && !first_word) {
+        if constexpr (S == style::snake) {
+          put('_');
+        } else if constexpr (S == style::kebab) {
+          put('-');
+        }
+      }
+      if constexpr (S == style::camel) {
+        put(word_start && !first_word ? to_upper(c) : to_lower(c));
+      } else {
+        put(to_lower(c));
+      }
+      first_word = false;
+      word_start = false;
+    }
   }
-  const auto v = p ? string_view{p.get()} : string_view{tn};
-  return {std::move(p), v};
-}
 
-template <typename T>
-string nameof_type_rtti(const char* tn) {
-  static_assert(nameof_type_rtti_supported<T>::value, "nameof::nameof_type_rtti unsupported compiler (https://github.com/Neargye/nameof#compiler-compatibility).");
-  const auto name = demangle(tn);
-  assert(!name.empty() && "Type does not have a name.");
-  return name.str();
+  return size;
 }
 
-template <typename T>
-string nameof_full_type_rtti(const char* tn) {
-  static_assert(nameof_type_rtti_supported<T>::value, "nameof::nameof_type_rtti unsupported compiler (https://github.com/Neargye/nameof#compiler-compatibility).");
-  const auto name = demangle(tn);
-  assert(!name.empty() && "Type does not have a name.");
-  return full_type_name<T>(name.str());
+template <typename E, style S, std::size_t I>
+constexpr auto styled_name() noexcept {
+  constexpr auto name = names_v<E>[I];
+  constexpr auto size = styled_name<S>(name, nullptr);
+  char chars[size + 1] = {};
+  styled_name<S>(name, chars);
+  return cstring<size>{string_view{chars, size}};
 }
 
-template <typename T, enable_if_has_short_name_t<T, int> = 0>
-string nameof_short_type_rtti(const char* tn) {
-  static_assert(nameof_type_rtti_supported<T>::value, "nameof::nameof_type_rtti unsupported compiler (https://github.com/Neargye/nameof#compiler-compatibility).");
-  const auto full_name = demangle(tn);
-  const auto name = pretty_name(full_name.view());
-  assert(!name.empty() && "Type does not have a short name.");
-  return {name.data(), name.size()};
+template <typename E, style S, std::size_t I>
+inline constexpr auto styled_name_v = styled_name<E, S, I>();
+
+template <typename E, style S, std::size_t... J>
+constexpr auto styled_names(std::index_sequence<J...>) noexcept {
+  constexpr auto names = std::array<string_view, sizeof...(J)>{{styled_name_v<E, S, J>...}};
+  return names;
 }
-#else
-template <typename T>
-string nameof_type_rtti(const char* tn) {
-  static_assert(nameof_type_rtti_supported<T>::value, "nameof::nameof_type_rtti unsupported compiler (https://github.com/Neargye/nameof#compiler-compatibility).");
-  const auto name = string_view{tn != nullptr ? tn : ""};
-  assert(!name.empty() && "Type does not have a name.");
-  return {name.data(), name.size()};
+
+template <typename E, style S>
+inline constexpr auto styled_names_v = styled_names<E, S>(std::make_index_sequence<count_v<E>>{});
+
+template <typename E, bool IsFlags, std::size_t... J>
+constexpr auto hashes(std::index_sequence<J...>) noexcept {
+  constexpr auto hashes = std::array<std::uint64_t, sizeof...(J)>{{enum_name_v<E, values_v<E, IsFlags>[J]>.hash()...}};
+  return hashes;
+}
+
+template <typename E, bool IsFlags = false>
+inline constexpr auto hashes_v = hashes<E, IsFlags>(std::make_index_sequence<count_v<E, IsFlags>>{});
+
+// Writes names of bits set in mask joined by sep to out, if out is not nullptr. Returns size of joined name.
+constexpr std::size_t join_flag_names(const string_view* names, std::size_t count, std::uint64_t mask, char sep, char* out) noexcept {
+  std::size_t size = 0;
+  for (std::size_t i = 0; i < count; ++i) {
+    if (((mask >> i) & 1U) == 0) {
+      continue;
+    }
+    if (size > 0) {
+      if (out != nullptr) {
+        out[size] = sep;
+      }
+      ++size;
+    }
+    for (std::size_t j = 0; j < names[i].size(); ++j) {
+      if (out != nullptr) {
+        out[size] = names[i][j];
+      }
+      ++size;
+    }
+  }
+  return size;
+}
+
+template <typename E, E V, std::size_t I, typename U = std::underlying_type_t<E>>
+constexpr string_view flag_bit_name() noexcept {
+  if constexpr (((static_cast<std::uint64_t>(V) >> I) & 1U) != 0) {
+    return enum_name_v<E, static_cast<E>(static_cast<U>(U{1} << I))>;
+  } else {
+    return {};
+  }
+}
+
+template <typename E, E V, char Sep, std::size_t... I>
+constexpr auto enum_flag_name(std::index_sequence<I...>) noexcept {
+  using U = std::make_unsigned_t<std::underlying_type_t<E>>;
+  constexpr auto mask = static_cast<std::uint64_t>(static_cast<U>(V));
+  constexpr std::array<string_view, sizeof...(I)> names = {{flag_bit_name<E, V, I>()...}};
+  constexpr bool valid = mask != 0 && (mask >> (sizeof...(I) - 1) >> 1) == 0 && ((((mask >> I) & 1U) == 0 || !names[I].empty()) && ...);
+
+  if constexpr (valid) {
+    constexpr auto size = join_flag_names(names.data(), names.size(), mask, Sep, nullptr);
+    char chars[size + 1] = {};
+    join_flag_names(names.data(), names.size(), mask, Sep, chars);
+    return cstring<size>{string_view{chars, size}};
+  } else {
+    return cstring<0>{};
+  }
+}
+
+template <typename E, E V, char Sep>
+inline constexpr auto enum_flag_name_v = enum_flag_name<E, V, Sep>(std::make_index_sequence<std::numeric_limits<std::underlying_type_t<E>>::digits>{});
+
+template <typename E>
+constexpr int flag_shift() noexcept {
+  if constexpr (count_v<E, true> == 0) {
+    return 0;
+  } else {
+    return static_cast<int>(log2(min_v<E, true>));
+  }
+}
+
+template <typename E>
+constexpr std::size_t flag_bits() noexcept {
+  if constexpr (count_v<E, true> == 0) {
+    return 0;
+  } else {
+    return static_cast<std::size_t>(log2(max_v<E, true>) - log2(min_v<E, true>)) + 1;
+  }
+}
+
+template <typename E>
+inline constexpr auto flag_shift_v = flag_shift<E>();
+
+template <typename E>
+inline constexpr auto flag_bits_v = flag_bits<E>();
+
+// Names of flags by bit position from flag_shift_v, empty for bits without a name.
+template <typename E, typename U = std::underlying_type_t<E>>
+constexpr auto flag_bit_names() noexcept {
+  std::array<string_view, flag_bits_v<E>> names{};
+  for (std::size_t i = 0; i < count_v<E, true>; ++i) {
+    const auto v = static_cast<U>(values_v<E, true>[i]);
+    names[static_cast<std::size_t>(log2(v)) - flag_shift_v<E>] = names_v<E, true>[i];
+  }
+  return names;
+}
+
+template <typename E>
+inline constexpr auto flag_bit_names_v = flag_bit_names<E>();
+
+// Mask of bits that have non-empty names.
+template <typename E>
+constexpr std::uint64_t flag_named_mask() noexcept {
+  std::uint64_t mask = 0;
+  for (std::size_t i = 0; i < flag_bits_v<E>; ++i) {
+    if (!flag_bit_names_v<E>[i].empty()) {
+      mask |= std::uint64_t{1} << i;
+    }
+  }
+  return mask;
+}
+
+template <typename E>
+constexpr std::size_t flag_table_size() noexcept {
+  constexpr auto named = flag_named_mask<E>();
+  std::size_t size = 0;
+  for (std::uint64_t mask = 1; mask < (std::uint64_t{1} << flag_bits_v<E>); ++mask) {
+    if ((mask & ~named) == 0) {
+      size += join_flag_names(flag_bit_names_v<E>.data(), flag_bits_v<E>, mask, '|', nullptr);
+    }
+  }
+  return size;
+}
+
+// Packed names of all combinations of flags, names of mask are chars[offsets[mask], offsets[mask + 1]).
+template <std::size_t Bits, std::size_t Size>
+struct flag_table {
+  std::array<std::uint32_t, (std::size_t{1} << Bits) + 1> offsets{};
+  std::array<char, Size + 1> chars{};
+};
+
+template <typename E, char Sep>
+constexpr auto make_flag_table() noexcept {
+  constexpr auto named = flag_named_mask<E>();
+  flag_table<flag_bits_v<E>, flag_table_size<E>()> table{};
+  std::size_t size = 0;
+  for (std::uint64_t mask = 0; mask < (std::uint64_t{1} << flag_bits_v<E>); ++mask) {
+    table.offsets[mask] = static_cast<std::uint32_t>(size);
+    if (mask != 0 && (mask & ~named) == 0) {
+      size += join_flag_names(flag_bit_names_v<E>.data(), flag_bits_v<E>, mask, Sep, table.chars.data() + size);
+    }
+  }
+  table.offsets.back() = static_cast<std::uint32_t>(size);
+  return table;
+}
+
+template <typename E, char Sep>
+inline constexpr auto flag_table_v = make_flag_table<E, Sep>();
+
+template <typename E, typename U = std::underlying_type_t<E>>
+constexpr std::size_t range_size() noexcept {
+  if constexpr (count_v<E> == 0) {
+    return 0;
+  } else {
+    return static_cast<std::size_t>(max_v<E> - min_v<E>) + 1;
+  }
+}
+
+template <typename E>
+inline constexpr std::size_t range_size_v = range_size<E>();
+
+// Jump table over [min_v, max_v] if it is small enough, otherwise over indexes of values_v.
+template <typename E>
+inline constexpr bool is_range_table_v = !is_sparse_v<E> || range_size_v<E> <= 1024;
+
+template <typename E, typename U = std::underlying_type_t<E>>
+constexpr std::size_t table_index(E value) noexcept {
+  if constexpr (is_range_table_v<E>) {
+    const auto v = static_cast<U>(value);
+    if (v >= min_v<E> && v <= max_v<E>) {
+      return static_cast<std::size_t>(v - min_v<E>);
+    }
+    return range_size_v<E>; // Out of range.
+  } else {
+    return search_index<E>(static_cast<U>(value));
+  }
+}
+
+template <typename E, std::size_t K, typename U = std::underlying_type_t<E>>
+constexpr std::size_t table_value_index() noexcept {
+  if constexpr (!is_sparse_v<E>) {
+    return K;
+  } else if constexpr (is_range_table_v<E>) {
+    for (std::size_t i = 0; i < count_v<E>; ++i) {
+      if (static_cast<U>(values_v<E>[i]) == static_cast<U>(min_v<E> + K)) {
+        return i;
+      }
+    }
+    return count_v<E>; // Hole in range.
+  } else {
+    return K;
+  }
+}
+
+template <typename E, typename R, typename F, std::size_t K>
+constexpr auto switch_case() noexcept -> R (*)(F&) {
+  constexpr auto i = table_value_index<E, K>();
+  if constexpr (i < count_v<E>) {
+    return [](F& f) -> R { return static_cast<R>(f(std::integral_constant<E, values_v<E>[i]>{})); };
+  } else {
+    return nullptr;
+  }
+}
+
+template <typename E, typename R, typename F, std::size_t... K>
+constexpr auto switch_table(std::index_sequence<K...>) noexcept {
+  constexpr auto table = std::array<R (*)(F&), sizeof...(K)>{{switch_case<E, R, F, K>()...}};
+  return table;
+}
+
+template <typename E, typename R, typename F>
+inline constexpr auto switch_table_v = switch_table<E, R, F>(std::make_index_sequence<is_range_table_v<E> ? range_size_v<E> : count_v<E>>{});
+
+// Common type of results of visitor for Size values from First, folded by halves, so depth of instantiation is logarithmic in count of values.
+template <typename E, typename F, std::size_t First, std::size_t Size>
+struct switch_result {
+  using type = std::common_type_t<typename switch_result<E, F, First, Size / 2>::type, typename switch_result<E, F, First + Size / 2, Size - Size / 2>::type>;
+};
+
+template <typename E, typename F, std::size_t First>
+struct switch_result<E, F, First, 1> {
+  using type = std::invoke_result_t<F&, std::integral_constant<E, values_v<E>[First]>>;
+};
+
+// Common type of results of visitor and fallback R, or R if enum does not have values.
+template <typename E, typename F, typename R, bool = (count_v<E> > 0)>
+struct switch_common {
+  using type = std::common_type_t<typename switch_result<E, F, 0, count_v<E>>::type, R>;
+};
+
+template <typename E, typename F, typename R>
+struct switch_common<E, F, R, false> {
+  using type = R;
+};
+
+template <typename E, typename F, typename R>
+using switch_common_t = typename switch_common<E, F, R>::type;
+
+template <typename E, E V, typename F>
+constexpr void for_each_invoke(F& f) {
+  if constexpr (std::is_invocable_v<F&, std::integral_constant<E, V>, const decltype(enum_name_v<E, V>)&>) {
+    f(std::integral_constant<E, V>{}, enum_name_v<E, V>);
+  } else {
+    f(std::integral_constant<E, V>{});
+  }
+}
+
+template <typename E, typename F, std::size_t... I>
+constexpr void for_each(F& f, std::index_sequence<I...>) {
+  (for_each_invoke<E, values_v<E>[I]>(f), ...);
+}
+
+template <typename D, typename E>
+constexpr decltype(auto) invoke_fallback(D& fallback, E value) {
+  if constexpr (std::is_invocable_v<D&, E>) {
+    return fallback(value);
+  } else {
+    return fallback();
+  }
+}
+
+// Calls put with names of flags of value joined by sep. Returns false without calls if value is zero or contains an unnamed flag.
+template <typename E, typename F, typename U = std::underlying_type_t<E>>
+bool put_flag_names(E value, char sep, F&& put) {
+  if constexpr (count_v<E, true> > 0) {
+    auto check_value = U{0};
+    for (std::size_t i = 0; i < count_v<E, true>; ++i) {
+      if (const auto v = static_cast<U>(enum_value<E, true>(i)); (static_cast<U>(value) & v) != 0) {
+        if (names_v<E, true>[i].empty()) {
+          return false; // Unnamed flag.
+        }
+        check_value |= v;
+      }
+    }
+    if (check_value == 0 || check_value != static_cast<U>(value)) {
+      return false; // Invalid value.
+    }
+
+    for (std::size_t i = 0, n = 0; i < count_v<E, true>; ++i) {
+      if ((static_cast<U>(value) & static_cast<U>(enum_value<E, true>(i))) != 0) {
+        if (n++ > 0) {
+          put(string_view{&sep, 1});
+        }
+        put(names_v<E, true>[i]);
+      }
+    }
+    return true;
+  } else {
+    return false;
+  }
+}
+
+template <typename E>
+struct enum_name_manip {
+  E value;
+};
+
+template <typename E>
+struct enum_flag_name_manip {
+  E value;
+  char sep;
+};
+
+template <typename Char, typename Traits, typename E>
+std::basic_ostream<Char, Traits>& operator<<(std::basic_ostream<Char, Traits>& os, enum_name_manip<E> manip) {
+  auto name = string_view{""};
+  if (const auto i = enum_index<E>(manip.value); i < count_v<E>) {
+    name = names_v<E>[i];
+  }
+  return ostream_insert(os, name.size(), [&name](auto& put) { put(name); });
+}
+
+template <typename Char, typename Traits, typename E>
+std::basic_ostream<Char, Traits>& operator<<(std::basic_ostream<Char, Traits>& os, enum_flag_name_manip<E> manip) {
+  std::size_t size = 0;
+  put_flag_names(manip.value, manip.sep, [&size](string_view str) { size += str.size(); });
+  return ostream_insert(os, size, [&manip](auto& put) { put_flag_names(manip.value, manip.sep, put); });
+}
+
+// Writes enum value to out: 'f' flags names, 'd' decimal number, 'x' hex number, otherwise name.
+// Writes decimal number if value does not have a name.
+template <typename E, typename OutputIt, typename U = std::underlying_type_t<E>>
+OutputIt format_enum(E value, char spec, OutputIt out) {
+  const auto put = [&out](string_view s) {
+    for (std::size_t i = 0; i < s.size(); ++i) {
+      *out++ = s[i];
+    }
+  };
+
+  if (spec == 'f') {
+    if (put_flag_names(value, '|', put)) {
+      return out;
+    }
+  } else if (spec != 'd' && spec != 'x') {
+    if constexpr (count_v<E> > 0) {
+      if (const auto i = enum_index<E>(value); i < count_v<E> && !names_v<E>[i].empty()) {
+        put(names_v<E>[i]);
+        return out;
+      }
+    }
+  }
+
+  char buffer[std::numeric_limits<U>::digits + 2] = {};
+  const auto number = static_cast<std::conditional_t<std::is_same_v<U, bool>, int, U>>(value);
+  const auto result = std::to_chars(buffer, buffer + sizeof(buffer), number, spec == 'x' ? 16 : 10);
+  put(string_view{buffer, static_cast<std::size_t>(result.ptr - buffer)});
+  return out;
+}
+
+template <typename... T>
+struct nameof_type_supported
+#if defined(NAMEOF_TYPE_SUPPORTED) && NAMEOF_TYPE_SUPPORTED || defined(NAMEOF_TYPE_NO_CHECK_SUPPORT)
+    : std::true_type {};
+#else
+    : std::false_type {};
+#endif
+
+template <typename... T>
+struct nameof_type_rtti_supported
+#if defined(NAMEOF_TYPE_RTTI_SUPPORTED) && NAMEOF_TYPE_RTTI_SUPPORTED || defined(NAMEOF_TYPE_NO_CHECK_SUPPORT)
+    : std::true_type {};
+#else
+    : std::false_type {};
+#endif
+
+template <typename... T>
+struct nameof_member_supported
+#if defined(NAMEOF_MEMBER_SUPPORTED) && NAMEOF_MEMBER_SUPPORTED || defined(NAMEOF_TYPE_NO_CHECK_SUPPORT)
+    : std::true_type {};
+#else
+    : std::false_type {};
+#endif
+
+template <typename... T>
+struct nameof_pointer_supported
+#if defined(NAMEOF_POINTER_SUPPORTED) && NAMEOF_POINTER_SUPPORTED || defined(NAMEOF_TYPE_NO_CHECK_SUPPORT)
+    : std::true_type {};
+#else
+    : std::false_type {};
+#endif
+
+#if defined(_MSC_VER) && !defined(__clang__)
+template <typename T>
+struct identity {
+  using type = T;
+};
+#else
+template <typename T>
+using identity = T;
+#endif
+
+template <typename T>
+using remove_cvref_t = std::remove_cv_t<std::remove_reference_t<T>>;
+
+template <typename T, typename R>
+using enable_if_has_short_name_t = std::enable_if_t<!std::is_array_v<T> && !std::is_pointer_v<T>, R>;
+
+template <typename... T>
+constexpr auto n() noexcept {
+#if defined(_MSC_VER) && !defined(__clang__)
+  [[maybe_unused]] constexpr auto custom_name = customize::type_name<typename T::type...>();
+#else
+  [[maybe_unused]] constexpr auto custom_name = customize::type_name<T...>();
+#endif
+
+  if constexpr (custom_name.empty() && nameof_type_supported<T...>::value) {
+#if defined(__clang__)
+    constexpr string_view name{__PRETTY_FUNCTION__ + 31, sizeof(__PRETTY_FUNCTION__) - 34};
+#elif defined(__GNUC__)
+    constexpr string_view name{__PRETTY_FUNCTION__ + 46, sizeof(__PRETTY_FUNCTION__) - 49};
+#elif defined(_MSC_VER)
+    constexpr string_view name{__FUNCSIG__ + 63, sizeof(__FUNCSIG__) - 81 - (__FUNCSIG__[sizeof(__FUNCSIG__) - 19] == ' ' ? 1 : 0)};
+#else
+    constexpr auto name = string_view{""};
+#endif
+    return cstring<name.size()>{name};
+  } else {
+    return cstring<custom_name.size()>{custom_name};
+  }
+}
+
+template <typename... T>
+inline constexpr auto type_name_v = n<T...>();
+
+template <typename T>
+constexpr auto short_type_name() noexcept {
+  constexpr auto name = pretty_name(type_name_v<T>);
+  static_assert(!name.empty(), "Type does not have a short name.");
+  return cstring<name.size()>{name};
+}
+
+template <typename T>
+inline constexpr auto short_type_name_v = short_type_name<T>();
+
+template <typename T>
+constexpr string_view type_qualifiers() noexcept {
+  using U = std::remove_reference_t<T>;
+  if constexpr (std::is_const_v<U> && std::is_volatile_v<U>) {
+    return string_view{"volatile const "};
+  } else if constexpr (std::is_const_v<U>) {
+    return string_view{"const "};
+  } else if constexpr (std::is_volatile_v<U>) {
+    return string_view{"volatile "};
+  } else {
+    return string_view{""};
+  }
+}
+
+template <typename T>
+constexpr string_view type_reference() noexcept {
+  if constexpr (std::is_lvalue_reference_v<T>) {
+    return string_view{"&"};
+  } else if constexpr (std::is_rvalue_reference_v<T>) {
+    return string_view{"&&"};
+  } else {
+    return string_view{""};
+  }
+}
+
+template <typename S, typename = void>
+struct has_reserve : std::false_type {};
+
+template <typename S>
+struct has_reserve<S, std::void_t<decltype(std::declval<S&>().reserve(std::size_t{}))>> : std::true_type {};
+
+template <typename T, typename S = string>
+S full_type_name(string_view name, S full_name = S{}) {
+  constexpr auto prefix = type_qualifiers<T>();
+  constexpr auto suffix = type_reference<T>();
+
+  if constexpr (has_reserve<S>::value) {
+    full_name.reserve(prefix.size() + name.size() + suffix.size());
+  }
+  full_name.append(prefix.data(), prefix.size());
+  full_name.append(name.data(), name.size());
+  full_name.append(suffix.data(), suffix.size());
+  return full_name;
+}
+
+#if __has_include(<cxxabi.h>)
+using demangle_ptr = std::unique_ptr<char, decltype(&std::free)>;
+
+struct demangled_name {
+  demangle_ptr p;
+  string_view v;
+
+  [[nodiscard]] string_view view() const noexcept { return v; }
+  [[nodiscard]] bool empty() const noexcept { return v.empty(); }
+  [[nodiscard]] string str() const { return {v.data(), v.size()}; }
+};
+
+inline demangled_name demangle(const char* tn) {
+  assert(tn != nullptr);
+  if (tn == nullptr) {
+    return {demangle_ptr{nullptr, &std::free}, string_view{""}};
+  }
+  int status = 0;
+  demangle_ptr p{abi::__cxa_demangle(tn, nullptr, nullptr, &status), &std::free};
+  if (status != 0) {
+    p.reset();
+  }
+  const auto v = p ? string_view{p.get()} : string_view{tn};
+  return {std::move(p), v};
+}
+
+template <typename T>
+string nameof_type_rtti(const char* tn) {
+  static_assert(nameof_type_rtti_supported<T>::value, "nameof::nameof_type_rtti unsupported compiler (https://github.com/Neargye/nameof#compiler-compatibility).");
+  const auto name = demangle(tn);
+  assert(!name.empty() && "Type does not have a name.");
+  return name.str();
+}
+
+template <typename T>
+string nameof_full_type_rtti(const char* tn) {
+  static_assert(nameof_type_rtti_supported<T>::value, "nameof::nameof_type_rtti unsupported compiler (https://github.com/Neargye/nameof#compiler-compatibility).");
+  const auto name = demangle(tn);
+  assert(!name.empty() && "Type does not have a name.");
+  return full_type_name<T>(name.view());
+}
+
+template <typename T, enable_if_has_short_name_t<T, int> = 0>
+string nameof_short_type_rtti(const char* tn) {
+  static_assert(nameof_type_rtti_supported<T>::value, "nameof::nameof_type_rtti unsupported compiler (https://github.com/Neargye/nameof#compiler-compatibility).");
+  const auto full_name = demangle(tn);
+  const auto name = pretty_name(full_name.view());
+  assert(!name.empty() && "Type does not have a short name.");
+  return {name.data(), name.size()};
+}
+
+#if defined(__cpp_lib_memory_resource)
+template <typename T>
+std::pmr::string nameof_type_rtti(const char* tn, std::pmr::memory_resource* resource) {
+  static_assert(nameof_type_rtti_supported<T>::value, "nameof::nameof_type_rtti unsupported compiler (https://github.com/Neargye/nameof#compiler-compatibility).");
+  const auto name = demangle(tn);
+  assert(!name.empty() && "Type does not have a name.");
+  return {name.view().data(), name.view().size(), resource};
+}
+
+template <typename T>
+std::pmr::string nameof_full_type_rtti(const char* tn, std::pmr::memory_resource* resource) {
+  static_assert(nameof_type_rtti_supported<T>::value, "nameof::nameof_type_rtti unsupported compiler (https://github.com/Neargye/nameof#compiler-compatibility).");
+  const auto name = demangle(tn);
+  assert(!name.empty() && "Type does not have a name.");
+  return full_type_name<T>(name.view(), std::pmr::string{resource});
+}
+
+template <typename T, enable_if_has_short_name_t<T, int> = 0>
+std::pmr::string nameof_short_type_rtti(const char* tn, std::pmr::memory_resource* resource) {
+  static_assert(nameof_type_rtti_supported<T>::value, "nameof::nameof_type_rtti unsupported compiler (https://github.com/Neargye/nameof#compiler-compatibility).");
+  const auto full_name = demangle(tn);
+  const auto name = pretty_name(full_name.view());
+  assert(!name.empty() && "Type does not have a short name.");
+  return {name.data(), name.size(), resource};
+}
+#endif
+#else
+template <typename T>
+string nameof_type_rtti(const char* tn) {
+  static_assert(nameof_type_rtti_supported<T>::value, "nameof::nameof_type_rtti unsupported compiler (https://github.com/Neargye/nameof#compiler-compatibility).");
+  const auto name = string_view{tn != nullptr ? tn : ""};
+  assert(!name.empty() && "Type does not have a name.");
+  return {name.data(), name.size()};
 }
 
 template <typename T>
@@ -1040,7 +1857,7 @@ string nameof_full_type_rtti(const char* tn) {
   static_assert(nameof_type_rtti_supported<T>::value, "nameof::nameof_type_rtti unsupported compiler (https://github.com/Neargye/nameof#compiler-compatibility).");
   const auto name = string_view{tn != nullptr ? tn : ""};
   assert(!name.empty() && "Type does not have a name.");
-  return full_type_name<T>({name.data(), name.size()});
+  return full_type_name<T>(name);
 }
 
 template <typename T, enable_if_has_short_name_t<T, int> = 0>
@@ -1050,6 +1867,32 @@ string nameof_short_type_rtti(const char* tn) {
   assert(!name.empty() && "Type does not have a short name.");
   return {name.data(), name.size()};
 }
+
+#if defined(__cpp_lib_memory_resource)
+template <typename T>
+std::pmr::string nameof_type_rtti(const char* tn, std::pmr::memory_resource* resource) {
+  static_assert(nameof_type_rtti_supported<T>::value, "nameof::nameof_type_rtti unsupported compiler (https://github.com/Neargye/nameof#compiler-compatibility).");
+  const auto name = string_view{tn != nullptr ? tn : ""};
+  assert(!name.empty() && "Type does not have a name.");
+  return {name.data(), name.size(), resource};
+}
+
+template <typename T>
+std::pmr::string nameof_full_type_rtti(const char* tn, std::pmr::memory_resource* resource) {
+  static_assert(nameof_type_rtti_supported<T>::value, "nameof::nameof_type_rtti unsupported compiler (https://github.com/Neargye/nameof#compiler-compatibility).");
+  const auto name = string_view{tn != nullptr ? tn : ""};
+  assert(!name.empty() && "Type does not have a name.");
+  return full_type_name<T>(name, std::pmr::string{resource});
+}
+
+template <typename T, enable_if_has_short_name_t<T, int> = 0>
+std::pmr::string nameof_short_type_rtti(const char* tn, std::pmr::memory_resource* resource) {
+  static_assert(nameof_type_rtti_supported<T>::value, "nameof::nameof_type_rtti unsupported compiler (https://github.com/Neargye/nameof#compiler-compatibility).");
+  const auto name = pretty_name(tn != nullptr ? tn : "");
+  assert(!name.empty() && "Type does not have a short name.");
+  return {name.data(), name.size(), resource};
+}
+#endif
 #endif
 
 template <auto V, auto U = V>
@@ -1070,10 +1913,6 @@ constexpr auto n() noexcept {
   }
 }
 
-#if defined(__clang__) || defined(__GNUC__)
-template <auto V>
-inline constexpr auto member_name_v = n<V>();
-#elif defined(_MSC_VER) && defined(_MSVC_LANG) && _MSVC_LANG >= 202002L
 template <typename From, typename Type>
 From get_base_type(Type From::*);
 
@@ -1088,26 +1927,197 @@ struct Store {
 template <typename T>
 Store(T) -> Store<T>;
 
+#if defined(__clang__) || defined(__GNUC__)
+template <auto V>
+inline constexpr auto member_name_v = n<V>();
+#elif defined(_MSC_VER) && defined(_MSVC_LANG) && _MSVC_LANG >= 202002L
 template <auto V>
 consteval auto get_member_name() noexcept {
   if constexpr (std::is_member_function_pointer_v<decltype(V)>) {
     return n<V>();
   } else {
-    constexpr bool is_defined = sizeof(decltype(get_base_type(V))) != 0;
-    static_assert(is_defined, "nameof::nameof_member member name can use only if the struct is already fully defined. Please use NAMEOF macro, or separate definition and declaration.");
-    if constexpr (is_defined) {
-      return n<V, Store{&(nonexist_object<decltype(get_base_type(V))>.*V)}>();
-    } else {
-      return "";
-    }
+    constexpr bool is_defined = sizeof(decltype(get_base_type(V))) != 0;
+    static_assert(is_defined, "nameof::nameof_member member name can use only if the struct is already fully defined. Please use NAMEOF macro, or separate definition and declaration.");
+    if constexpr (is_defined) {
+      return n<V, Store{&(nonexist_object<decltype(get_base_type(V))>.*V)}>();
+    } else {
+      return "";
+    }
+  }
+}
+
+template <auto V>
+inline constexpr auto member_name_v = get_member_name<V>();
+#else
+template <auto V>
+inline constexpr auto member_name_v = cstring<0>{};
+#endif
+
+constexpr bool is_identifier_char(char c) noexcept {
+  return (c >= '0' && c <= '9') || (c >= 'a' && c <= 'z') || (c >= 'A' && c <= 'Z') || c == '_';
+}
+
+constexpr string_view field_name(string_view name) noexcept {
+  while (name.size() > 0 && !is_identifier_char(name[name.size() - 1])) {
+    name.remove_suffix(1);
+  }
+  std::size_t i = name.size();
+  for (; i > 0 && is_identifier_char(name[i - 1]); --i) {}
+  name.remove_prefix(i);
+
+  if (name.size() > 0 && !(name[0] >= '0' && name[0] <= '9')) {
+    return name;
+  }
+
+  return {}; // Invalid name.
+}
+
+template <auto V>
+constexpr auto f() noexcept {
+#if defined(__clang__) || defined(__GNUC__)
+  constexpr auto name = field_name({__PRETTY_FUNCTION__, sizeof(__PRETTY_FUNCTION__) - 1});
+#elif defined(_MSC_VER)
+  constexpr auto name = field_name({__FUNCSIG__, sizeof(__FUNCSIG__) - 17});
+#else
+  constexpr auto name = string_view{""};
+#endif
+  return cstring<name.size()>{name};
+}
+
+#if defined(NAMEOF_MEMBERS_SUPPORTED) && NAMEOF_MEMBERS_SUPPORTED
+template <std::size_t>
+struct any_field {
+  template <typename T>
+  operator T&() const noexcept; // Not defined, used only in unevaluated operands.
+};
+
+template <typename T, typename I, typename = void>
+struct is_brace_constructible : std::false_type {};
+
+template <typename T, std::size_t... I>
+struct is_brace_constructible<T, std::index_sequence<I...>, std::void_t<decltype(T{any_field<I>{}...})>> : std::true_type {};
+
+inline constexpr std::size_t members_max = 64;
+
+template <typename T, std::size_t N = 0>
+constexpr std::size_t members_count() noexcept {
+  if constexpr (N <= members_max && is_brace_constructible<T, std::make_index_sequence<N + 1>>::value) {
+    return members_count<T, N + 1>();
+  } else {
+    return N;
+  }
+}
+
+template <std::size_t I, typename P, typename... Ps>
+constexpr auto nth(P p, Ps... ps) noexcept {
+  if constexpr (I == 0) {
+    return p;
+  } else {
+    return nth<I - 1>(ps...);
   }
 }
 
-template <auto V>
-inline constexpr auto member_name_v = get_member_name<V>();
-#else
-template <auto V>
-inline constexpr auto member_name_v = cstring<0>{};
+template <std::size_t I, typename... M>
+constexpr auto nth_pointer(M&... m) noexcept {
+  return nth<I>(&m...);
+}
+
+// Identifiers of structured bindings for N members.
+#define NAMEOF_MEMBERS_1 m0
+#define NAMEOF_MEMBERS_2 NAMEOF_MEMBERS_1, m1
+#define NAMEOF_MEMBERS_3 NAMEOF_MEMBERS_2, m2
+#define NAMEOF_MEMBERS_4 NAMEOF_MEMBERS_3, m3
+#define NAMEOF_MEMBERS_5 NAMEOF_MEMBERS_4, m4
+#define NAMEOF_MEMBERS_6 NAMEOF_MEMBERS_5, m5
+#define NAMEOF_MEMBERS_7 NAMEOF_MEMBERS_6, m6
+#define NAMEOF_MEMBERS_8 NAMEOF_MEMBERS_7, m7
+#define NAMEOF_MEMBERS_9 NAMEOF_MEMBERS_8, m8
+#define NAMEOF_MEMBERS_10 NAMEOF_MEMBERS_9, m9
+#define NAMEOF_MEMBERS_11 NAMEOF_MEMBERS_10, m10
+#define NAMEOF_MEMBERS_12 NAMEOF_MEMBERS_11, m11
+#define NAMEOF_MEMBERS_13 NAMEOF_MEMBERS_12, m12
+#define NAMEOF_MEMBERS_14 NAMEOF_MEMBERS_13, m13
+#define NAMEOF_MEMBERS_15 NAMEOF_MEMBERS_14, m14
+#define NAMEOF_MEMBERS_16 NAMEOF_MEMBERS_15, m15
+#define NAMEOF_MEMBERS_17 NAMEOF_MEMBERS_16, m16
+#define NAMEOF_MEMBERS_18 NAMEOF_MEMBERS_17, m17
+#define NAMEOF_MEMBERS_19 NAMEOF_MEMBERS_18, m18
+#define NAMEOF_MEMBERS_20 NAMEOF_MEMBERS_19, m19
+#define NAMEOF_MEMBERS_21 NAMEOF_MEMBERS_20, m20
+#define NAMEOF_MEMBERS_22 NAMEOF_MEMBERS_21, m21
+#define NAMEOF_MEMBERS_23 NAMEOF_MEMBERS_22, m22
+#define NAMEOF_MEMBERS_24 NAMEOF_MEMBERS_23, m23
+#define NAMEOF_MEMBERS_25 NAMEOF_MEMBERS_24, m24
+#define NAMEOF_MEMBERS_26 NAMEOF_MEMBERS_25, m25
+#define NAMEOF_MEMBERS_27 NAMEOF_MEMBERS_26, m26
+#define NAMEOF_MEMBERS_28 NAMEOF_MEMBERS_27, m27
+#define NAMEOF_MEMBERS_29 NAMEOF_MEMBERS_28, m28
+#define NAMEOF_MEMBERS_30 NAMEOF_MEMBERS_29, m29
+#define NAMEOF_MEMBERS_31 NAMEOF_MEMBERS_30, m30
+#define NAMEOF_MEMBERS_32 NAMEOF_MEMBERS_31, m31
+#define NAMEOF_MEMBERS_33 NAMEOF_MEMBERS_32, m32
+#define NAMEOF_MEMBERS_34 NAMEOF_MEMBERS_33, m33
+#define NAMEOF_MEMBERS_35 NAMEOF_MEMBERS_34, m34
+#define NAMEOF_MEMBERS_36 NAMEOF_MEMBERS_35, m35
+#define NAMEOF_MEMBERS_37 NAMEOF_MEMBERS_36, m36
+#define NAMEOF_MEMBERS_38 NAMEOF_MEMBERS_37, m37
+#define NAMEOF_MEMBERS_39 NAMEOF_MEMBERS_38, m38
+#define NAMEOF_MEMBERS_40 NAMEOF_MEMBERS_39, m39
+#define NAMEOF_MEMBERS_41 NAMEOF_MEMBERS_40, m40
+#define NAMEOF_MEMBERS_42 NAMEOF_MEMBERS_41, m41
+#define NAMEOF_MEMBERS_43 NAMEOF_MEMBERS_42, m42
+#define NAMEOF_MEMBERS_44 NAMEOF_MEMBERS_43, m43
+#define NAMEOF_MEMBERS_45 NAMEOF_MEMBERS_44, m44
+#define NAMEOF_MEMBERS_46 NAMEOF_MEMBERS_45, m45
+#define NAMEOF_MEMBERS_47 NAMEOF_MEMBERS_46, m46
+#define NAMEOF_MEMBERS_48 NAMEOF_MEMBERS_47, m47
+#define NAMEOF_MEMBERS_49 NAMEOF_MEMBERS_48, m48
+#define NAMEOF_MEMBERS_50 NAMEOF_MEMBERS_49, m49
+#define NAMEOF_MEMBERS_51 NAMEOF_MEMBERS_50, m50
+#define NAMEOF_MEMBERS_52 NAMEOF_MEMBERS_51, m51
+#define NAMEOF_MEMBERS_53 NAMEOF_MEMBERS_52, m52
+#define NAMEOF_MEMBERS_54 NAMEOF_MEMBERS_53, m53
+#define NAMEOF_MEMBERS_55 NAMEOF_MEMBERS_54, m54
+#define NAMEOF_MEMBERS_56 NAMEOF_MEMBERS_55, m55
+#define NAMEOF_MEMBERS_57 NAMEOF_MEMBERS_56, m56
+#define NAMEOF_MEMBERS_58 NAMEOF_MEMBERS_57, m57
+#define NAMEOF_MEMBERS_59 NAMEOF_MEMBERS_58, m58
+#define NAMEOF_MEMBERS_60 NAMEOF_MEMBERS_59, m59
+#define NAMEOF_MEMBERS_61 NAMEOF_MEMBERS_60, m60
+#define NAMEOF_MEMBERS_62 NAMEOF_MEMBERS_61, m61
+#define NAMEOF_MEMBERS_63 NAMEOF_MEMBERS_62, m62
+#define NAMEOF_MEMBERS_64 NAMEOF_MEMBERS_63, m63
+
+template <typename T, std::size_t I, std::size_t N = members_count<T>()>
+constexpr auto member_pointer() noexcept {
+#define NAMEOF_MEMBER_POINTER(K)                          \
+  if constexpr (N == K) {                                 \
+    auto& [NAMEOF_MEMBERS_##K] = nonexist_object<T>;      \
+    return nth_pointer<I>(NAMEOF_MEMBERS_##K);            \
+  } else
+
+  NAMEOF_MEMBER_POINTER(1) NAMEOF_MEMBER_POINTER(2) NAMEOF_MEMBER_POINTER(3) NAMEOF_MEMBER_POINTER(4) NAMEOF_MEMBER_POINTER(5) NAMEOF_MEMBER_POINTER(6) NAMEOF_MEMBER_POINTER(7) NAMEOF_MEMBER_POINTER(8) \
+  NAMEOF_MEMBER_POINTER(9) NAMEOF_MEMBER_POINTER(10) NAMEOF_MEMBER_POINTER(11) NAMEOF_MEMBER_POINTER(12) NAMEOF_MEMBER_POINTER(13) NAMEOF_MEMBER_POINTER(14) NAMEOF_MEMBER_POINTER(15) NAMEOF_MEMBER_POINTER(16) \
+  NAMEOF_MEMBER_POINTER(17) NAMEOF_MEMBER_POINTER(18) NAMEOF_MEMBER_POINTER(19) NAMEOF_MEMBER_POINTER(20) NAMEOF_MEMBER_POINTER(21) NAMEOF_MEMBER_POINTER(22) NAMEOF_MEMBER_POINTER(23) NAMEOF_MEMBER_POINTER(24) \
+  NAMEOF_MEMBER_POINTER(25) NAMEOF_MEMBER_POINTER(26) NAMEOF_MEMBER_POINTER(27) NAMEOF_MEMBER_POINTER(28) NAMEOF_MEMBER_POINTER(29) NAMEOF_MEMBER_POINTER(30) NAMEOF_MEMBER_POINTER(31) NAMEOF_MEMBER_POINTER(32) \
+  NAMEOF_MEMBER_POINTER(33) NAMEOF_MEMBER_POINTER(34) NAMEOF_MEMBER_POINTER(35) NAMEOF_MEMBER_POINTER(36) NAMEOF_MEMBER_POINTER(37) NAMEOF_MEMBER_POINTER(38) NAMEOF_MEMBER_POINTER(39) NAMEOF_MEMBER_POINTER(40) \
+  NAMEOF_MEMBER_POINTER(41) NAMEOF_MEMBER_POINTER(42) NAMEOF_MEMBER_POINTER(43) NAMEOF_MEMBER_POINTER(44) NAMEOF_MEMBER_POINTER(45) NAMEOF_MEMBER_POINTER(46) NAMEOF_MEMBER_POINTER(47) NAMEOF_MEMBER_POINTER(48) \
+  NAMEOF_MEMBER_POINTER(49) NAMEOF_MEMBER_POINTER(50) NAMEOF_MEMBER_POINTER(51) NAMEOF_MEMBER_POINTER(52) NAMEOF_MEMBER_POINTER(53) NAMEOF_MEMBER_POINTER(54) NAMEOF_MEMBER_POINTER(55) NAMEOF_MEMBER_POINTER(56) \
+  NAMEOF_MEMBER_POINTER(57) NAMEOF_MEMBER_POINTER(58) NAMEOF_MEMBER_POINTER(59) NAMEOF_MEMBER_POINTER(60) NAMEOF_MEMBER_POINTER(61) NAMEOF_MEMBER_POINTER(62) NAMEOF_MEMBER_POINTER(63) NAMEOF_MEMBER_POINTER(64) {}
+#undef NAMEOF_MEMBER_POINTER
+}
+
+template <typename T, std::size_t I>
+inline constexpr auto field_name_v = f<Store{member_pointer<T, I>()}>();
+
+template <typename T, std::size_t... I>
+constexpr auto members(std::index_sequence<I...>) noexcept {
+  constexpr auto names = std::array<string_view, sizeof...(I)>{{field_name_v<T, I>...}};
+  return names;
+}
+
+template <typename T>
+inline constexpr auto members_v = members<T>(std::make_index_sequence<members_count<T>()>{});
 #endif
 
 template <auto U, auto V>
@@ -1164,25 +2174,82 @@ inline constexpr bool is_nameof_enum_supported = detail::nameof_enum_supported<v
 template <typename E>
 [[nodiscard]] constexpr auto nameof_enum(E value) noexcept -> detail::enable_if_enum_t<E, string_view> {
   using D = std::decay_t<E>;
-  using U = std::underlying_type_t<D>;
   static_assert(detail::nameof_enum_supported<D>::value, "nameof::nameof_enum unsupported compiler (https://github.com/Neargye/nameof#compiler-compatibility).");
   static_assert(detail::count_v<D> > 0, "nameof::nameof_enum requires enum implementation and valid max and min.");
 
-  if constexpr (detail::is_sparse_v<D>) {
-    for (std::size_t i = 0; i < detail::count_v<D>; ++i) {
-      if (detail::enum_value<D>(i) == value) {
-        return detail::names_v<D>[i];
-      }
-    }
-  } else {
-    const auto v = static_cast<U>(value);
-    if (v >= detail::min_v<D> && v <= detail::max_v<D>) {
-      return detail::names_v<D>[static_cast<std::size_t>(v - detail::min_v<D>)];
-    }
+  if (const auto i = detail::enum_index<D>(value); i < detail::count_v<D>) {
+    return detail::names_v<D>[i];
+  }
+  return string_view{""};
+}
+
+// Obtains name of enum variable in style.
+template <typename E, style S>
+[[nodiscard]] constexpr auto nameof_enum(E value) noexcept -> detail::enable_if_enum_t<E, string_view> {
+  using D = std::decay_t<E>;
+  static_assert(detail::nameof_enum_supported<D>::value, "nameof::nameof_enum unsupported compiler (https://github.com/Neargye/nameof#compiler-compatibility).");
+  static_assert(detail::count_v<D> > 0, "nameof::nameof_enum requires enum implementation and valid max and min.");
+
+  if (const auto i = detail::enum_index<D>(value); i < detail::count_v<D>) {
+    return detail::styled_names_v<D, S>[i];
   }
   return string_view{""};
 }
 
+// Obtains hash of enum variable name.
+// Hash is 64-bit FNV-1a of name, which is equal to hash of empty name if no name is available.
+template <typename E>
+[[nodiscard]] constexpr auto nameof_enum_hash(E value) noexcept -> detail::enable_if_enum_t<E, std::uint64_t> {
+  using D = std::decay_t<E>;
+  static_assert(detail::nameof_enum_supported<D>::value, "nameof::nameof_enum_hash unsupported compiler (https://github.com/Neargye/nameof#compiler-compatibility).");
+  static_assert(detail::count_v<D> > 0, "nameof::nameof_enum_hash requires enum implementation and valid max and min.");
+
+  if (const auto i = detail::enum_index<D>(value); i < detail::count_v<D>) {
+    return detail::hashes_v<D>[i];
+  }
+  return detail::hash(string_view{});
+}
+
+// Checks whether integer value is a value of enum, in constant time for sparse enums with small range.
+template <typename E, typename I>
+[[nodiscard]] constexpr auto enum_contains(I value) noexcept -> detail::enable_if_enum_t<E, bool> {
+  using D = std::decay_t<E>;
+  using U = std::underlying_type_t<D>;
+  static_assert(detail::nameof_enum_supported<D>::value, "nameof::enum_contains unsupported compiler (https://github.com/Neargye/nameof#compiler-compatibility).");
+  static_assert(std::is_integral_v<I> && !std::is_same_v<I, bool>, "nameof::enum_contains requires integer value.");
+
+  return detail::in_range<U>(value) && detail::enum_contains<D>(static_cast<U>(value));
+}
+
+// Checks whether integer value is a non-zero combination of named enum flags, with a single mask compare.
+template <typename E, typename I>
+[[nodiscard]] constexpr auto enum_flags_contains(I value) noexcept -> detail::enable_if_enum_t<E, bool> {
+  using D = std::decay_t<E>;
+  using U = std::underlying_type_t<D>;
+  static_assert(detail::nameof_enum_supported<D>::value, "nameof::enum_flags_contains unsupported compiler (https://github.com/Neargye/nameof#compiler-compatibility).");
+  static_assert(std::is_integral_v<I> && !std::is_same_v<I, bool>, "nameof::enum_flags_contains requires integer value.");
+
+  if (!detail::in_range<U>(value)) {
+    return false;
+  }
+  const auto mask = static_cast<U>(value);
+  return mask != U{0} && (mask & ~detail::flags_mask_v<D>) == U{0};
+}
+
+// Obtains rank of enum value name in alphabetical order of names, or count of enum values if no name is available.
+// Sorting by rank gives the same order as sorting by name, without string compares.
+template <typename E>
+[[nodiscard]] constexpr auto enum_name_rank(E value) noexcept -> detail::enable_if_enum_t<E, std::size_t> {
+  using D = std::decay_t<E>;
+  static_assert(detail::nameof_enum_supported<D>::value, "nameof::enum_name_rank unsupported compiler (https://github.com/Neargye/nameof#compiler-compatibility).");
+  static_assert(detail::count_v<D> > 0, "nameof::enum_name_rank requires enum implementation and valid max and min.");
+
+  if (const auto i = detail::enum_index<D>(value); i < detail::count_v<D>) {
+    return detail::name_ranks_v<D>[i];
+  }
+  return detail::count_v<D>;
+}
+
 // Obtains name of enum value or default value if no name is available.
 template <typename E>
 [[nodiscard]] auto nameof_enum_or(E value, string_view default_value) -> detail::enable_if_enum_t<E, string> {
@@ -1197,6 +2264,60 @@ template <typename E>
   return string{default_value.data(), default_value.size()};
 }
 
+#if defined(__cpp_lib_memory_resource)
+// Obtains name of enum value or default value if no name is available, allocated by memory resource.
+template <typename E>
+[[nodiscard]] auto nameof_enum_or(E value, string_view default_value, std::pmr::memory_resource* resource) -> detail::enable_if_enum_t<E, std::pmr::string> {
+  using D = std::decay_t<E>;
+  static_assert(detail::nameof_enum_supported<D>::value, "nameof::nameof_enum_or unsupported compiler (https://github.com/Neargye/nameof#compiler-compatibility).");
+
+  if constexpr (detail::count_v<D> > 0) {
+    if (auto v = nameof_enum<D>(value); !v.empty()) {
+      return {v.data(), v.size(), resource};
+    }
+  }
+  return {default_value.data(), default_value.size(), resource};
+}
+#endif
+
+// Obtains name of enum value, or writes "TypeName(number)" to buffer if no name is available.
+// Returns static storage name, view of buffer, or empty string_view if buffer is too small.
+template <typename E>
+[[nodiscard]] auto nameof_enum_or_number(E value, char* buffer, std::size_t size) noexcept -> detail::enable_if_enum_t<E, string_view> {
+  using D = std::decay_t<E>;
+  using U = std::underlying_type_t<D>;
+  static_assert(detail::nameof_enum_supported<D>::value, "nameof::nameof_enum_or_number unsupported compiler (https://github.com/Neargye/nameof#compiler-compatibility).");
+
+  if constexpr (detail::count_v<D> > 0) {
+    if (const auto i = detail::enum_index<D>(value); i < detail::count_v<D>) {
+      return detail::names_v<D>[i];
+    }
+  }
+
+  constexpr auto& type_name = detail::type_name_v<detail::identity<D>>;
+  if (size < type_name.size() + 2) {
+    return string_view{""};
+  }
+  for (std::size_t i = 0; i < type_name.size(); ++i) {
+    buffer[i] = type_name[i];
+  }
+  buffer[type_name.size()] = '(';
+
+  const auto number = static_cast<std::conditional_t<std::is_same_v<U, bool>, int, U>>(value);
+  const auto [end, ec] = std::to_chars(buffer + type_name.size() + 1, buffer + size - 1, number);
+  if (ec != std::errc{}) {
+    return string_view{""};
+  }
+  *end = ')';
+  return string_view{buffer, static_cast<std::size_t>(end - buffer) + 1};
+}
+
+// Obtains name of enum value, or writes "TypeName(number)" to buffer if no name is available.
+template <typename E, std::size_t N>
+[[nodiscard]] auto nameof_enum_or_number(E value, char (&buffer)[N]) noexcept -> detail::enable_if_enum_t<E, string_view> {
+  return nameof_enum_or_number<E>(value, buffer, N);
+}
+
 // Obtains name of enum flag value.
 template <typename E>
 [[nodiscard]] auto nameof_enum_flag(E value, char sep = '|') -> detail::enable_if_enum_t<E, string> {
@@ -1227,6 +2348,58 @@ template <typename E>
   return {}; // Invalid value.
 }
 
+#if defined(__cpp_lib_memory_resource)
+// Obtains name of enum flag value, allocated by memory resource.
+template <typename E>
+[[nodiscard]] auto nameof_enum_flag(E value, char sep, std::pmr::memory_resource* resource) -> detail::enable_if_enum_t<E, std::pmr::string> {
+  using D = std::decay_t<E>;
+  static_assert(detail::nameof_enum_supported<D>::value, "nameof::nameof_enum_flag unsupported compiler (https://github.com/Neargye/nameof#compiler-compatibility).");
+  static_assert(detail::count_v<D, true> > 0, "nameof::nameof_enum_flag requires enum-flags implementation.");
+
+  std::pmr::string name{resource};
+  detail::put_flag_names<D>(value, sep, [&name](string_view str) { name.append(str.data(), str.size()); });
+  return name;
+}
+#endif
+
+// Obtains name of enum flag value from compile-time table of all combinations of flags, without allocation.
+// Flags must be in NAMEOF_ENUM_FLAG_TABLE_MAX_BITS consecutive bits.
+template <char Sep = '|', typename E>
+[[nodiscard]] constexpr auto nameof_enum_flag_view(E value) noexcept -> detail::enable_if_enum_t<E, string_view> {
+  using D = std::decay_t<E>;
+  using U = std::make_unsigned_t<std::underlying_type_t<D>>;
+  static_assert(detail::nameof_enum_supported<D>::value, "nameof::nameof_enum_flag_view unsupported compiler (https://github.com/Neargye/nameof#compiler-compatibility).");
+  static_assert(detail::count_v<D, true> > 0, "nameof::nameof_enum_flag_view requires enum-flags implementation.");
+  static_assert(detail::flag_bits_v<D> <= NAMEOF_ENUM_FLAG_TABLE_MAX_BITS, "nameof::nameof_enum_flag_view requires flags in NAMEOF_ENUM_FLAG_TABLE_MAX_BITS consecutive bits.");
+
+  constexpr auto& table = detail::flag_table_v<D, Sep>;
+  constexpr auto shift = detail::flag_shift_v<D>;
+  constexpr auto mask = static_cast<U>(((std::uint64_t{1} << detail::flag_bits_v<D>) - 1) << shift);
+  if (const auto v = static_cast<U>(value); (v & ~mask) == 0) {
+    const auto i = static_cast<std::size_t>(v >> shift);
+    return string_view{table.chars.data() + table.offsets[i], table.offsets[i + 1] - table.offsets[i]};
+  }
+  return string_view{""}; // Invalid value.
+}
+
+// Stream manipulator, inserts name of enum variable without building a string.
+template <typename E>
+[[nodiscard]] constexpr auto as_name(E value) noexcept -> detail::enable_if_enum_t<E, detail::enum_name_manip<std::decay_t<E>>> {
+  using D = std::decay_t<E>;
+  static_assert(detail::nameof_enum_supported<D>::value, "nameof::as_name unsupported compiler (https://github.com/Neargye/nameof#compiler-compatibility).");
+  static_assert(detail::count_v<D> > 0, "nameof::as_name requires enum implementation and valid max and min.");
+  return {value};
+}
+
+// Stream manipulator, inserts name of enum flag variable without building a string.
+template <typename E>
+[[nodiscard]] constexpr auto as_flag_name(E value, char sep = '|') noexcept -> detail::enable_if_enum_t<E, detail::enum_flag_name_manip<std::decay_t<E>>> {
+  using D = std::decay_t<E>;
+  static_assert(detail::nameof_enum_supported<D>::value, "nameof::as_flag_name unsupported compiler (https://github.com/Neargye/nameof#compiler-compatibility).");
+  static_assert(detail::count_v<D, true> > 0, "nameof::as_flag_name requires enum-flags implementation.");
+  return {value, sep};
+}
+
 // Obtains name of static storage enum variable.
 // This version is much lighter on the compile times and is not restricted to the enum_range limitation.
 template <auto V, detail::enable_if_enum_t<decltype(V), int> = 0>
@@ -1237,6 +2410,116 @@ template <auto V, detail::enable_if_enum_t<decltype(V), int> = 0>
   return detail::enum_name_v<D, V>;
 }
 
+// Obtains name of static storage enum flag variable.
+// This version is not restricted to the enum_range limitation, name is empty if value is zero or contains an unnamed flag.
+template <auto V, char Sep = '|', detail::enable_if_enum_t<decltype(V), int> = 0>
+[[nodiscard]] constexpr const auto& nameof_enum_flag() noexcept {
+  using D = std::decay_t<decltype(V)>;
+  static_assert(std::is_enum_v<D>, "nameof::nameof_enum_flag requires member enum type.");
+  static_assert(detail::nameof_enum_supported<D>::value, "nameof::nameof_enum_flag unsupported compiler (https://github.com/Neargye/nameof#compiler-compatibility).");
+  return detail::enum_flag_name_v<D, V, Sep>;
+}
+
+// Calls f for each enum value with std::integral_constant of value and name, or only with std::integral_constant of value.
+template <typename E, typename F>
+constexpr void enum_for_each(F&& f) {
+  using D = std::decay_t<E>;
+  static_assert(std::is_enum_v<D>, "nameof::enum_for_each requires enum type.");
+  static_assert(detail::nameof_enum_supported<D>::value, "nameof::enum_for_each unsupported compiler (https://github.com/Neargye/nameof#compiler-compatibility).");
+  static_assert(detail::count_v<D> > 0, "nameof::enum_for_each requires enum implementation and valid max and min.");
+
+  detail::for_each<D>(f, std::make_index_sequence<detail::count_v<D>>{});
+}
+
+// Calls visitor with std::integral_constant of enum value, or fallback if value does not have a name or is out of range.
+// Fallback is called with value, or without arguments.
+template <typename E, typename F, typename D>
+constexpr auto enum_switch(E value, F&& visitor, D&& fallback) -> detail::switch_common_t<std::decay_t<E>, F, decltype(detail::invoke_fallback(fallback, value))> {
+  using T = std::decay_t<E>;
+  using R = detail::switch_common_t<T, F, decltype(detail::invoke_fallback(fallback, value))>;
+  static_assert(detail::nameof_enum_supported<T>::value, "nameof::enum_switch unsupported compiler (https://github.com/Neargye/nameof#compiler-compatibility).");
+  static_assert(detail::count_v<T> > 0, "nameof::enum_switch requires enum implementation and valid max and min.");
+
+  constexpr auto& table = detail::switch_table_v<T, R, F>;
+  if (const auto i = detail::table_index<T>(value); i < table.size() && table[i] != nullptr) {
+    return table[i](visitor);
+  }
+  return static_cast<R>(detail::invoke_fallback(fallback, value));
+}
+
+// Type-erased descriptor of enum type, obtains names of values erased to std::uint64_t without knowing enum type.
+class enum_descriptor {
+ public:
+  using index_type = std::size_t (*)(std::uint64_t) noexcept;
+
+  constexpr enum_descriptor(string_view type_name, const string_view* names, std::size_t size, index_type index) noexcept
+      : type_name_{type_name}, names_{names}, size_{size}, index_{index} {}
+
+  [[nodiscard]] constexpr string_view type_name() const noexcept { return type_name_; }
+
+  [[nodiscard]] constexpr std::size_t size() const noexcept { return size_; }
+
+  // Obtains name of erased value, or empty string_view if value does not have a name or is out of range.
+  [[nodiscard]] constexpr string_view name(std::uint64_t value) const noexcept {
+    if (const auto i = index_(value); i < size_) {
+      return names_[i];
+    }
+    return string_view{""};
+  }
+
+ private:
+  string_view type_name_;
+  const string_view* names_;
+  std::size_t size_;
+  index_type index_;
+};
+
+namespace detail {
+
+template <typename E, typename U = std::underlying_type_t<E>>
+constexpr std::uint64_t erase_value(E value) noexcept {
+  return static_cast<std::uint64_t>(static_cast<U>(value));
+}
+
+template <typename E, typename U = std::underlying_type_t<E>>
+constexpr std::size_t erased_index(std::uint64_t value) noexcept {
+  return enum_index<E>(static_cast<E>(static_cast<U>(value)));
+}
+
+template <typename E>
+inline constexpr auto enum_descriptor_v = enum_descriptor{type_name_v<identity<E>>, names_v<E>.data(), count_v<E>, &erased_index<E>};
+
+} // namespace nameof::detail
+
+// Obtains type-erased descriptor of enum type.
+template <typename E>
+[[nodiscard]] constexpr auto enum_descriptor_of() noexcept -> detail::enable_if_enum_t<E, const enum_descriptor&> {
+  using D = std::decay_t<E>;
+  static_assert(detail::nameof_enum_supported<D>::value, "nameof::enum_descriptor_of unsupported compiler (https://github.com/Neargye/nameof#compiler-compatibility).");
+  static_assert(detail::count_v<D> > 0, "nameof::enum_descriptor_of requires enum implementation and valid max and min.");
+  return detail::enum_descriptor_v<D>;
+}
+
+// Type-erased reference to enum value, holds erased value and pointer to static descriptor of enum type.
+// Trivially copyable, name can be obtained later on any thread.
+class enum_ref {
+ public:
+  template <typename E, detail::enable_if_enum_t<E, int> = 0>
+  constexpr enum_ref(E value) noexcept : descriptor_{&enum_descriptor_of<E>()}, value_{detail::erase_value<std::decay_t<E>>(value)} {}
+
+  [[nodiscard]] constexpr const enum_descriptor& descriptor() const noexcept { return *descriptor_; }
+
+  [[nodiscard]] constexpr std::uint64_t value() const noexcept { return value_; }
+
+  [[nodiscard]] constexpr string_view type_name() const noexcept { return descriptor_->type_name(); }
+
+  [[nodiscard]] constexpr string_view name() const noexcept { return descriptor_->name(value_); }
+
+ private:
+  const enum_descriptor* descriptor_;
+  std::uint64_t value_;
+};
+
 // Obtains name of type, reference and cv-qualifiers are ignored.
 template <typename T>
 [[nodiscard]] constexpr const auto& nameof_type() noexcept {
@@ -1262,6 +2545,124 @@ template <typename T, detail::enable_if_has_short_name_t<T, int> = 0>
   return detail::short_type_name_v<U>;
 }
 
+// Obtains hash of type name, reference and cv-qualifiers are ignored.
+template <typename T>
+[[nodiscard]] constexpr std::uint64_t type_hash() noexcept {
+  return nameof_type<T>().hash();
+}
+
+// Type identifier without RTTI, based on type name. Comparison checks hash collisions by type names.
+// Distinct types with the same name compare equal, e.g. types in anonymous namespaces of different translation units, or types with equal customize::type_name.
+class type_index {
+ public:
+  constexpr type_index(std::uint64_t hash, string_view name) noexcept : hash_{hash}, name_{name} {}
+
+  [[nodiscard]] constexpr std::uint64_t hash() const noexcept { return hash_; }
+
+  [[nodiscard]] constexpr string_view name() const noexcept { return name_; }
+
+  [[nodiscard]] constexpr int compare(const type_index& other) const noexcept {
+    if (hash_ != other.hash_) {
+      return hash_ < other.hash_ ? -1 : 1;
+    } else if (name_.data() == other.name_.data() && name_.size() == other.name_.size()) {
+      return 0;
+    }
+    return name_.compare(other.name_);
+  }
+
+ private:
+  std::uint64_t hash_;
+  string_view name_;
+};
+
+[[nodiscard]] constexpr bool operator==(const type_index& lhs, const type_index& rhs) noexcept {
+  return lhs.compare(rhs) == 0;
+}
+
+[[nodiscard]] constexpr bool operator!=(const type_index& lhs, const type_index& rhs) noexcept {
+  return lhs.compare(rhs) != 0;
+}
+
+[[nodiscard]] constexpr bool operator<(const type_index& lhs, const type_index& rhs) noexcept {
+  return lhs.compare(rhs) < 0;
+}
+
+[[nodiscard]] constexpr bool operator<=(const type_index& lhs, const type_index& rhs) noexcept {
+  return lhs.compare(rhs) <= 0;
+}
+
+[[nodiscard]] constexpr bool operator>(const type_index& lhs, const type_index& rhs) noexcept {
+  return lhs.compare(rhs) > 0;
+}
+
+[[nodiscard]] constexpr bool operator>=(const type_index& lhs, const type_index& rhs) noexcept {
+  return lhs.compare(rhs) >= 0;
+}
+
+// Obtains identifier of type, reference and cv-qualifiers are ignored.
+template <typename T>
+[[nodiscard]] constexpr type_index type_id() noexcept {
+  const auto& name = nameof_type<T>();
+  return {name.hash(), name};
+}
+
+// Base of polymorphic hierarchy, obtains name of dynamic type by one virtual call, without RTTI.
+class named_base {
+ public:
+  virtual ~named_base() = default;
+
+  // Obtains name of dynamic type.
+  [[nodiscard]] virtual string_view dynamic_type_name() const noexcept = 0;
+
+  // Obtains short name of dynamic type.
+  [[nodiscard]] virtual string_view dynamic_short_type_name() const noexcept = 0;
+};
+
+// Mixin, implements names of dynamic type of Base by name of Derived.
+template <typename Derived, typename Base = named_base>
+class named : public Base {
+  static_assert(std::is_base_of_v<named_base, Base>, "nameof::named requires Base derived from nameof::named_base.");
+
+ public:
+  using Base::Base;
+
+  [[nodiscard]] string_view dynamic_type_name() const noexcept override { return nameof_type<Derived>(); }
+
+  [[nodiscard]] string_view dynamic_short_type_name() const noexcept override { return nameof_short_type<Derived>(); }
+};
+
+namespace detail {
+
+template <typename T>
+auto nameof_type_dynamic(const T& value) {
+  if constexpr (std::is_base_of_v<named_base, T>) {
+    return value.dynamic_type_name();
+  } else {
+#if defined(NAMEOF_TYPE_RTTI_SUPPORTED) && NAMEOF_TYPE_RTTI_SUPPORTED
+    return nameof_type_rtti<T>(typeid(value).name());
+#else
+    static_assert(std::is_base_of_v<named_base, T>, "nameof::nameof_type_dynamic requires type derived from nameof::named_base or RTTI.");
+    return string_view{};
+#endif
+  }
+}
+
+template <typename T>
+auto nameof_short_type_dynamic(const T& value) {
+  if constexpr (std::is_base_of_v<named_base, T>) {
+    return value.dynamic_short_type_name();
+  } else {
+#if defined(NAMEOF_TYPE_RTTI_SUPPORTED) && NAMEOF_TYPE_RTTI_SUPPORTED
+    return nameof_short_type_rtti<T>(typeid(value).name());
+#else
+    static_assert(std::is_base_of_v<named_base, T>, "nameof::nameof_short_type_dynamic requires type derived from nameof::named_base or RTTI.");
+    return string_view{};
+#endif
+  }
+}
+
+} // namespace nameof::detail
+
 // Obtains name of member.
 template <auto V, std::enable_if_t<std::is_member_pointer_v<decltype(V)>, int> = 0>
 [[nodiscard]] constexpr const auto& nameof_member() noexcept {
@@ -1271,6 +2672,17 @@ template <auto V, std::enable_if_t<std::is_member_pointer_v<decltype(V)>, int> =
   return detail::member_name_v<V>;
 }
 
+#if defined(NAMEOF_MEMBERS_SUPPORTED) && NAMEOF_MEMBERS_SUPPORTED
+// Obtains names of all fields of aggregate.
+template <typename T>
+[[nodiscard]] constexpr const auto& nameof_members() noexcept {
+  using U = detail::remove_cvref_t<T>;
+  static_assert(std::is_aggregate_v<U> && !std::is_union_v<U>, "nameof::nameof_members requires aggregate type.");
+  static_assert(detail::members_count<U>() <= detail::members_max, "nameof::nameof_members requires aggregate with at most 64 fields.");
+  return detail::members_v<U>;
+}
+#endif
+
 // Obtains name of a function, a global or class static variable.
 template <auto V, std::enable_if_t<std::is_pointer_v<decltype(V)>, int> = 0>
 [[nodiscard]] constexpr const auto& nameof_pointer() noexcept {
@@ -1293,9 +2705,44 @@ struct std::formatter<nameof::cstring<N>, char> : std::formatter<std::string_vie
     return std::formatter<std::string_view, char>::format(std::string_view{value.data(), value.size()}, ctx);
   }
 };
+
+template <typename E>
+  requires std::is_enum_v<E> && nameof::customize::enum_format<E>::value
+struct std::formatter<E, char> {
+  char spec = '\0';
+
+  constexpr auto parse(std::format_parse_context& ctx) {
+    auto it = ctx.begin();
+    if (it != ctx.end() && (*it == 'f' || *it == 'd' || *it == 'x')) {
+      spec = *it++;
+    }
+    if (it != ctx.end() && *it != '}') {
+      throw std::format_error("nameof::formatter invalid format for enum, expected {}, {:f}, {:d} or {:x}.");
+    }
+    return it;
+  }
+
+  template <typename FormatContext>
+  auto format(E value, FormatContext& ctx) const {
+    return nameof::detail::format_enum(value, spec, ctx.out());
+  }
+};
 #  endif
 #endif
 
+template <std::uint16_t N>
+struct std::hash<nameof::cstring<N>> {
+  [[nodiscard]] constexpr std::size_t operator()(const nameof::cstring<N>& value) const noexcept {
+    return static_cast<std::size_t>(value.hash());
+  }
+};
+
+template <>
+struct std::hash<nameof::type_index> {
+  [[nodiscard]] constexpr std::size_t operator()(const nameof::type_index& value) const noexcept {
+    return static_cast<std::size_t>(value.hash());
+  }
+};
 
 #if defined(FMT_VERSION)
 template <std::uint16_t N>
@@ -1305,6 +2752,27 @@ struct fmt::formatter<nameof::cstring<N>> : fmt::formatter<fmt::string_view> {
     return fmt::formatter<fmt::string_view>::format(fmt::string_view{value.data(), value.size()}, ctx);
   }
 };
+
+template <typename E>
+struct fmt::formatter<E, char, std::enable_if_t<std::is_enum_v<E> && nameof::customize::enum_format<E>::value>> {
+  char spec = '\0';
+
+  constexpr auto parse(fmt::format_parse_context& ctx) {
+    auto it = ctx.begin();
+    if (it != ctx.end() && (*it == 'f' || *it == 'd' || *it == 'x')) {
+      spec = *it++;
+    }
+    if (it != ctx.end() && *it != '}') {
+      throw fmt::format_error("nameof::formatter invalid format for enum, expected {}, {:f}, {:d} or {:x}.");
+    }
+    return it;
+  }
+
+  template <typename FormatContext>
+  auto format(E value, FormatContext& ctx) const {
+    return nameof::detail::format_enum(value, spec, ctx.out());
+  }
+};
 #endif
 
 // Obtains name of variable, function, macro.
@@ -1347,6 +2815,10 @@ struct fmt::formatter<nameof::cstring<N>> : fmt::formatter<fmt::string_view> {
 // Obtains name of enum flag value.
 #define NAMEOF_ENUM_FLAG(...) ::nameof::nameof_enum_flag<::std::decay_t<decltype(__VA_ARGS__)>>(__VA_ARGS__)
 
+// Obtains name of static storage enum flag variable.
+// This version is not restricted to the enum_range limitation.
+#define NAMEOF_ENUM_FLAG_CONST(...) ::nameof::nameof_enum_flag<__VA_ARGS__>()
+
 // Obtains type name, reference and cv-qualifiers are ignored.
 #define NAMEOF_TYPE(...) ::nameof::nameof_type<__VA_ARGS__>()
 
@@ -1374,6 +2846,23 @@ struct fmt::formatter<nameof::cstring<N>> : fmt::formatter<fmt::string_view> {
 // Obtains short type name, using RTTI.
 #define NAMEOF_SHORT_TYPE_RTTI(...) ::nameof::detail::nameof_short_type_rtti<decltype(__VA_ARGS__)>(typeid(__VA_ARGS__).name())
 
+// Obtains name of dynamic type by nameof::named_base, or using RTTI otherwise.
+#define NAMEOF_TYPE_DYNAMIC(...) ::nameof::detail::nameof_type_dynamic(__VA_ARGS__)
+
+// Obtains short name of dynamic type by nameof::named_base, or using RTTI otherwise.
+#define NAMEOF_SHORT_TYPE_DYNAMIC(...) ::nameof::detail::nameof_short_type_dynamic(__VA_ARGS__)
+
+#if defined(__cpp_lib_memory_resource)
+// Obtains type name, with reference and cv-qualifiers, using RTTI, allocated by memory resource.
+#  define NAMEOF_TYPE_RTTI_PMR(resource, ...) ::nameof::detail::nameof_type_rtti<::std::void_t<decltype(__VA_ARGS__)>>(typeid(__VA_ARGS__).name(), resource)
+
+// Obtains full type name, using RTTI, allocated by memory resource.
+#  define NAMEOF_FULL_TYPE_RTTI_PMR(resource, ...) ::nameof::detail::nameof_full_type_rtti<decltype(__VA_ARGS__)>(typeid(__VA_ARGS__).name(), resource)
+
+// Obtains short type name, using RTTI, allocated by memory resource.
+#  define NAMEOF_SHORT_TYPE_RTTI_PMR(resource, ...) ::nameof::detail::nameof_short_type_rtti<decltype(__VA_ARGS__)>(typeid(__VA_ARGS__).name(), resource)
+#endif
+
 // Obtains name of member.
 #define NAMEOF_MEMBER(...) ::nameof::nameof_member<__VA_ARGS__>()
 
@@ -0,0 +1,368 @@
+//  _   _                             __    _____
+// | \ | |                           / _|  / ____|_     _
+// |  \| | __ _ _ __ ___   ___  ___ | |_  | |   _| |_ _| |_
+// | . ` |/ _` | '_ ` _ \ / _ \/ _ \|  _| | |  |_   _|_   _|
+// | |\  | (_| | | | | | |  __/ (_) | |   | |____|_|   |_|
+// |_| \_|\__,_|_| |_| |_|\___|\___/|_|    \_____|
+// https://github.com/Neargye/nameof
+// version 0.10.6
+//
+// Licensed under the MIT License <http://opensource.org/licenses/MIT>.
+// SPDX-License-Identifier: MIT
+// Copyright (c) 2026 Daniil Goncharov <neargye@gmail.com>.
+//
+// Permission is hereby  granted, free of charge, to any  person obtaining a copy
+// of this software and associated  documentation files (the "Software"), to deal
+// in the Software  without restriction, including without  limitation the rights
+// to  use, copy,  modify, merge,  publish, distribute,  sublicense, and/or  sell
+// copies  of  the Software,  and  to  permit persons  to  whom  the Software  is
+// furnished to do so, subject to the following conditions:
+//
+// The above copyright notice and this permission notice shall be included in all
+// copies or substantial portions of the Software.
+//
+// THE SOFTWARE  IS PROVIDED "AS  IS", WITHOUT WARRANTY  OF ANY KIND,  EXPRESS OR
+// IMPLIED,  INCLUDING BUT  NOT  LIMITED TO  THE  WARRANTIES OF  MERCHANTABILITY,
+// FITNESS FOR  A PARTICULAR PURPOSE AND  NONINFRINGEMENT. IN NO EVENT  SHALL THE
+// AUTHORS  OR COPYRIGHT  HOLDERS  BE  LIABLE FOR  ANY  CLAIM,  DAMAGES OR  OTHER
+// LIABILITY, WHETHER IN AN ACTION OF  CONTRACT, TORT OR OTHERWISE, ARISING FROM,
+// OUT OF OR IN CONNECTION WITH THE SOFTWARE  OR THE USE OR OTHER DEALINGS IN THE
+// SOFTWARE.
+
+#ifndef NEARGYE_NAMEOF_CONTAINERS_HPP
+#define NEARGYE_NAMEOF_CONTAINERS_HPP
+
+#include "nameof.hpp"
+
+#include <algorithm>
+#include <array>
+#include <atomic>
+#include <cassert>
+#include <cstddef>
+#include <cstdint>
+#include <iterator>
+#include <utility>
+#include <vector>
+
+namespace nameof {
+
+namespace detail {
+
+// Size of cache line, to avoid false sharing between shards of counters.
+inline constexpr std::size_t cache_line_size = 64;
+
+// Index of current thread, assigned once per thread in order of first use.
+inline std::size_t thread_index() noexcept {
+  static std::atomic<std::size_t> next{0};
+  thread_local const std::size_t index = next.fetch_add(1, std::memory_order_relaxed);
+  return index;
+}
+
+// Index of each value of [min_v, max_v] in values_v, or count_v for holes.
+template <typename E, typename U = std::underlying_type_t<E>>
+constexpr auto value_index_table() noexcept {
+  std::array<std::uint16_t, range_size_v<E>> table{};
+  for (std::size_t i = 0; i < table.size(); ++i) {
+    table[i] = static_cast<std::uint16_t>(count_v<E>);
+  }
+  for (std::size_t i = 0; i < count_v<E>; ++i) {
+    table[static_cast<std::size_t>(static_cast<U>(values_v<E>[i]) - min_v<E>)] = static_cast<std::uint16_t>(i);
+  }
+  return table;
+}
+
+template <typename E>
+inline constexpr auto value_index_table_v = value_index_table<E>();
+
+// Index of value in values_v, or count_v if value does not have a name.
+// Arithmetic for dense enums, compile-time table over [min_v, max_v] for sparse enums with small range, otherwise binary search over values_v.
+template <typename E, typename U = std::underlying_type_t<E>>
+constexpr std::size_t packed_index(E value) noexcept {
+  if constexpr (!is_sparse_v<E>) {
+    return enum_index<E>(value);
+  } else if constexpr (is_range_table_v<E>) {
+    const auto v = static_cast<U>(value);
+    if (v < min_v<E> || v > max_v<E>) {
+      return count_v<E>;
+    }
+    return value_index_table_v<E>[static_cast<std::size_t>(v - min_v<E>)];
+  } else {
+    return search_index<E>(static_cast<U>(value));
+  }
+}
+
+} // namespace nameof::detail
+
+// Counters of events per enum value, sharded by thread to avoid contention.
+// Each thread increments counters of its own cache line padded shard, reads sum all shards.
+// Values without a name or out of range are counted by unknown().
+template <typename E, std::size_t Shards = 16>
+class enum_counter {
+  static_assert(std::is_enum_v<E>, "nameof::enum_counter requires enum type.");
+  static_assert(detail::nameof_enum_supported<E>::value, "nameof::enum_counter unsupported compiler (https://github.com/Neargye/nameof#compiler-compatibility).");
+  static_assert(detail::count_v<E> > 0, "nameof::enum_counter requires enum implementation and valid max and min.");
+  static_assert(Shards > 0, "nameof::enum_counter requires at least one shard.");
+
+ public:
+  using value_type = E;
+  using snapshot_type = std::array<std::pair<string_view, std::uint64_t>, detail::count_v<E>>;
+
+  enum_counter() noexcept = default;
+
+  enum_counter(const enum_counter&) = delete;
+  enum_counter& operator=(const enum_counter&) = delete;
+
+  void add(E value, std::uint64_t n = 1) noexcept {
+    auto& counter = shards_[detail::thread_index() % Shards].counts[detail::packed_index<E>(value)];
+    counter.fetch_add(n, std::memory_order_relaxed);
+  }
+
+  void increment(E value) noexcept { add(value, 1); }
+
+  [[nodiscard]] std::uint64_t count(E value) const noexcept { return sum(detail::packed_index<E>(value)); }
+
+  [[nodiscard]] std::uint64_t unknown() const noexcept { return sum(detail::count_v<E>); }
+
+  [[nodiscard]] std::uint64_t total() const noexcept {
+    std::uint64_t total = 0;
+    for (std::size_t i = 0; i <= detail::count_v<E>; ++i) {
+      total += sum(i);
+    }
+    return total;
+  }
+
+  // Pairs of names and counts, in order of enum values.
+  [[nodiscard]] snapshot_type snapshot() const noexcept {
+    snapshot_type result{};
+    for (std::size_t i = 0; i < detail::count_v<E>; ++i) {
+      result[i] = {detail::names_v<E>[i], sum(i)};
+    }
+    return result;
+  }
+
+  // Calls f(value, name, count) for each enum value.
+  template <typename F>
+  void for_each(F&& f) const {
+    for (std::size_t i = 0; i < detail::count_v<E>; ++i) {
+      f(detail::values_v<E>[i], detail::names_v<E>[i], sum(i));
+    }
+  }
+
+  void reset() noexcept {
+    for (auto& shard : shards_) {
+      for (auto& counter : shard.counts) {
+        counter.store(0, std::memory_order_relaxed);
+      }
+    }
+  }
+
+ private:
+  // Last counter is for unknown values.
+  struct alignas(detail::cache_line_size) shard {
+    std::array<std::atomic<std::uint64_t>, detail::count_v<E> + 1> counts{};
+  };
+
+  std::uint64_t sum(std::size_t i) const noexcept {
+    std::uint64_t sum = 0;
+    for (const auto& shard : shards_) {
+      sum += shard.counts[i].load(std::memory_order_relaxed);
+    }
+    return sum;
+  }
+
+  std::array<shard, Shards> shards_{};
+};
+
+// Vector of enum values, stored as indexes of values at bit_width(count - 1) bits per element.
+// Elements do not cross 64-bit words, so pack and unpack of whole words are branch-free loops.
+// Values without a name or out of range are rejected by push_back, set and pack, so every stored element is a value of enum.
+template <typename E>
+class packed_enum_vector {
+  static_assert(std::is_enum_v<E>, "nameof::packed_enum_vector requires enum type.");
+  static_assert(detail::nameof_enum_supported<E>::value, "nameof::packed_enum_vector unsupported compiler (https://github.com/Neargye/nameof#compiler-compatibility).");
+  static_assert(detail::count_v<E> > 0, "nameof::packed_enum_vector requires enum implementation and valid max and min.");
+
+ public:
+  using value_type = E;
+  using size_type = std::size_t;
+
+  // Bits per element, enough for indexes of all values.
+  static constexpr size_type bits_per_value = detail::count_v<E> > 1 ? detail::log2(detail::count_v<E> - 1) + 1 : 1;
+
+  // Elements per 64-bit word.
+  static constexpr size_type values_per_word = 64 / bits_per_value;
+
+  // Iterator over values, elements are decoded on dereference, so it is an input iterator.
+  class const_iterator {
+   public:
+    using iterator_category = std::input_iterator_tag;
+    using value_type = E;
+    using difference_type = std::ptrdiff_t;
+    using pointer = void;
+    using reference = E;
+
+    const_iterator() noexcept = default;
+
+    [[nodiscard]] E operator*() const noexcept { return (*vector_)[index_]; }
+
+    const_iterator& operator++() noexcept {
+      ++index_;
+      return *this;
+    }
+
+    const_iterator operator++(int) noexcept {
+      auto it = *this;
+      ++index_;
+      return it;
+    }
+
+    [[nodiscard]] friend bool operator==(const const_iterator& lhs, const const_iterator& rhs) noexcept { return lhs.index_ == rhs.index_; }
+
+    [[nodiscard]] friend bool operator!=(const const_iterator& lhs, const const_iterator& rhs) noexcept { return lhs.index_ != rhs.index_; }
+
+   private:
+    friend class packed_enum_vector;
+
+    const_iterator(const packed_enum_vector* vector, size_type index) noexcept : vector_{vector}, index_{index} {}
+
+    const packed_enum_vector* vector_ = nullptr;
+    size_type index_ = 0;
+  };
+
+  packed_enum_vector() = default;
+
+  [[nodiscard]] size_type size() const noexcept { return size_; }
+
+  [[nodiscard]] bool empty() const noexcept { return size_ == 0; }
+
+  [[nodiscard]] size_type capacity() const noexcept { return words_.capacity() * values_per_word; }
+
+  // Size of storage in bytes.
+  [[nodiscard]] size_type memory_size() const noexcept { return words_.size() * sizeof(std::uint64_t); }
+
+  void reserve(size_type n) { words_.reserve(words_for(n)); }
+
+  void clear() noexcept {
+    words_.clear();
+    size_ = 0;
+  }
+
+  // Appends value. Returns false without changes if value does not have a name or is out of range.
+  bool push_back(E value) {
+    const auto k = detail::packed_index<E>(value);
+    if (k >= detail::count_v<E>) {
+      return false;
+    }
+    if (size_ % values_per_word == 0) {
+      words_.push_back(0);
+    }
+    store(size_++, k);
+    return true;
+  }
+
+  // Replaces element. Returns false without changes if value does not have a name or is out of range.
+  bool set(size_type i, E value) noexcept {
+    assert(i < size_ && "Index out of range.");
+    const auto k = detail::packed_index<E>(value);
+    if (k >= detail::count_v<E>) {
+      return false;
+    }
+    store(i, k);
+    return true;
+  }
+
+  [[nodiscard]] E operator[](size_type i) const noexcept {
+    assert(i < size_ && "Index out of range.");
+    return detail::enum_value<E>(load(i));
+  }
+
+  [[nodiscard]] string_view name(size_type i) const noexcept {
+    assert(i < size_ && "Index out of range.");
+    return detail::names_v<E>[load(i)];
+  }
+
+  // Appends values, whole words are encoded without read-modify-write.
+  // Stops at first value that does not have a name or is out of range, returns count of appended values.
+  size_type pack(const E* values, size_type count) {
+    if (words_for(size_ + count) > words_.capacity()) {
+      words_.reserve((std::max)(words_.capacity() * 2, words_for(size_ + count)));
+    }
+    size_type i = 0;
+    for (; i < count && size_ % values_per_word != 0; ++i) {
+      if (!push_back(values[i])) {
+        return i;
+      }
+    }
+    for (; count - i >= values_per_word; i += values_per_word) {
+      std::uint64_t word = 0;
+      bool valid = true;
+      for (size_type j = 0; j < values_per_word; ++j) {
+        const auto k = detail::packed_index<E>(values[i + j]);
+        valid &= k < detail::count_v<E>;
+        word |= static_cast<std::uint64_t>(k) << (j * bits_per_value);
+      }
+      if (!valid) {
+        break;
+      }
+      words_.push_back(word);
+      size_ += values_per_word;
+    }
+    for (; i < count; ++i) {
+      if (!push_back(values[i])) {
+        return i;
+      }
+    }
+    return count;
+  }
+
+  // Writes count values starting from element pos to out.
+  void unpack(size_type pos, size_type count, E* out) const noexcept {
+    assert(pos <= size_ && count <= size_ - pos && "Range out of range.");
+    size_type i = 0;
+    for (; i < count && (pos + i) % values_per_word != 0; ++i) {
+      out[i] = (*this)[pos + i];
+    }
+    for (; count - i >= values_per_word; i += values_per_word) {
+      const auto word = words_[(pos + i) / values_per_word];
+      for (size_type j = 0; j < values_per_word; ++j) {
+        out[i + j] = detail::enum_value<E>(static_cast<size_type>((word >> (j * bits_per_value)) & mask));
+      }
+    }
+    for (; i < count; ++i) {
+      out[i] = (*this)[pos + i];
+    }
+  }
+
+  // Calls f(value, name) for each element.
+  template <typename F>
+  void for_each(F&& f) const {
+    for (size_type i = 0; i < size_; ++i) {
+      const auto k = load(i);
+      f(detail::enum_value<E>(k), detail::names_v<E>[k]);
+    }
+  }
+
+  [[nodiscard]] const_iterator begin() const noexcept { return {this, 0}; }
+
+  [[nodiscard]] const_iterator end() const noexcept { return {this, size_}; }
+
+ private:
+  static constexpr std::uint64_t mask = (std::uint64_t{1} << bits_per_value) - 1;
+
+  static constexpr size_type words_for(size_type n) noexcept { return (n + values_per_word - 1) / values_per_word; }
+
+  void store(size_type i, size_type k) noexcept {
+    const auto shift = (i % values_per_word) * bits_per_value;
+    auto& word = words_[i / values_per_word];
+    word = (word & ~(mask << shift)) | (static_cast<std::uint64_t>(k) << shift);
+  }
+
+  size_type load(size_type i) const noexcept { return static_cast<size_type>((words_[i / values_per_word] >> ((i % values_per_word) * bits_per_value)) & mask); }
+
+  std::vector<std::uint64_t> words_;
+  size_type size_ = 0;
+};
+
+} // namespace nameof
+
+#endif // NEARGYE_NAMEOF_CONTAINERS_HPP
@@ -0,0 +1,275 @@
+//  _   _                             __    _____
+// | \ | |                           / _|  / ____|_     _
+// |  \| | __ _ _ __ ___   ___  ___ | |_  | |   _| |_ _| |_
+// | . ` |/ _` | '_ ` _ \ / _ \/ _ \|  _| | |  |_   _|_   _|
+// | |\  | (_| | | | | | |  __/ (_) | |   | |____|_|   |_|
+// |_| \_|\__,_|_| |_| |_|\___|\___/|_|    \_____|
+// https://github.com/Neargye/nameof
+// version 0.10.6
+//
+// Licensed under the MIT License <http://opensource.org/licenses/MIT>.
+// SPDX-License-Identifier: MIT
+// Copyright (c) 2026 Daniil Goncharov <neargye@gmail.com>.
+//
+// Permission is hereby  granted, free of charge, to any  person obtaining a copy
+// of this software and associated  documentation files (the "Software"), to deal
+// in the Software  without restriction, including without  limitation the rights
+// to  use, copy,  modify, merge,  publish, distribute,  sublicense, and/or  sell
+// copies  of  the Software,  and  to  permit persons  to  whom  the Software  is
+// furnished to do so, subject to the following conditions:
+//
+// The above copyright notice and this permission notice shall be included in all
+// copies or substantial portions of the Software.
+//
+// THE SOFTWARE  IS PROVIDED "AS  IS", WITHOUT WARRANTY  OF ANY KIND,  EXPRESS OR
+// IMPLIED,  INCLUDING BUT  NOT  LIMITED TO  THE  WARRANTIES OF  MERCHANTABILITY,
+// FITNESS FOR  A PARTICULAR PURPOSE AND  NONINFRINGEMENT. IN NO EVENT  SHALL THE
+// AUTHORS  OR COPYRIGHT  HOLDERS  BE  LIABLE FOR  ANY  CLAIM,  DAMAGES OR  OTHER
+// LIABILITY, WHETHER IN AN ACTION OF  CONTRACT, TORT OR OTHERWISE, ARISING FROM,
+// OUT OF OR IN CONNECTION WITH THE SOFTWARE  OR THE USE OR OTHER DEALINGS IN THE
+// SOFTWARE.
+
+#ifndef NEARGYE_NAMEOF_REGISTRY_HPP
+#define NEARGYE_NAMEOF_REGISTRY_HPP
+
+#include "nameof.hpp"
+
+#include <algorithm>
+#include <array>
+#include <atomic>
+#include <cstddef>
+#include <cstdint>
+#include <initializer_list>
+#include <mutex>
+#include <type_traits>
+#include <vector>
+#if defined(NAMEOF_TYPE_RTTI_SUPPORTED) && NAMEOF_TYPE_RTTI_SUPPORTED
+#  include <typeinfo>
+#endif
+
+// Max number of registered RTTI type names. By default NAMEOF_TYPE_NAME_TABLE_CAPACITY = 256.
+// If need another capacity, redefine the macro NAMEOF_TYPE_NAME_TABLE_CAPACITY.
+#if !defined(NAMEOF_TYPE_NAME_TABLE_CAPACITY)
+#  define NAMEOF_TYPE_NAME_TABLE_CAPACITY 256
+#endif
+
+namespace nameof {
+
+#if defined(NAMEOF_POINTER_SUPPORTED) && NAMEOF_POINTER_SUPPORTED
+namespace detail {
+
+struct function_name_entry {
+  std::uintptr_t address;
+  string_view name;
+};
+
+// Registration copies current table, inserts entries sorted by address and publishes the copy, readers only load table and binary search.
+// Tables are never freed, so readers never see a table being modified. Superseded tables stay reachable by retired list of live table.
+struct function_name_table {
+  std::vector<function_name_entry> entries;
+  const function_name_table* retired = nullptr;
+};
+
+inline std::atomic<const function_name_table*> function_names{nullptr};
+
+inline std::mutex function_names_mutex;
+
+template <typename F>
+std::uintptr_t function_address(F* f) noexcept {
+  return reinterpret_cast<std::uintptr_t>(f);
+}
+
+inline auto lower_bound_function(const std::vector<function_name_entry>& entries, std::uintptr_t address) noexcept {
+  return std::lower_bound(entries.begin(), entries.end(), address, [](const function_name_entry& entry, std::uintptr_t a) { return entry.address < a; });
+}
+
+inline void register_function_names(std::initializer_list<function_name_entry> functions) {
+  const std::lock_guard<std::mutex> lock{function_names_mutex};
+  const auto* current = function_names.load(std::memory_order_relaxed);
+  auto* table = new function_name_table{};
+  if (current != nullptr) {
+    table->entries.reserve(current->entries.size() + functions.size());
+    table->entries.assign(current->entries.begin(), current->entries.end());
+    table->retired = current;
+  }
+  auto& entries = table->entries;
+  for (const auto& function : functions) {
+    // Identical functions may be folded to one address, first registered name is kept.
+    if (const auto it = lower_bound_function(entries, function.address); it == entries.end() || it->address != function.address) {
+      entries.insert(it, function);
+    }
+  }
+  function_names.store(table, std::memory_order_release);
+}
+
+} // namespace nameof::detail
+
+// Registers compile-time names of functions, to obtain them later by nameof_pointer(f).
+// Publishes a new table for each call, register functions in batches at startup, e.g. with NAMEOF_REGISTER_FUNCTIONS.
+template <auto... V>
+void register_function_names() {
+  static_assert(((std::is_pointer_v<decltype(V)> && std::is_function_v<std::remove_pointer_t<decltype(V)>>) && ...), "nameof::register_function_names requires function pointers.");
+  static_assert((detail::nameof_pointer_supported<decltype(V)>::value && ...), "nameof::register_function_names unsupported compiler (https://github.com/Neargye/nameof#compiler-compatibility).");
+  detail::register_function_names({detail::function_name_entry{detail::function_address(V), detail::pointer_name_v<V>}...});
+}
+
+// Obtains registered name of function by runtime pointer, or empty string_view if function is not registered.
+// Does not allocate or lock, can be called concurrently with registration, lookup is binary search over table sorted by address.
+template <typename F, std::enable_if_t<std::is_function_v<F>, int> = 0>
+[[nodiscard]] string_view nameof_pointer(F* f) noexcept {
+  if (const auto* table = detail::function_names.load(std::memory_order_acquire); table != nullptr) {
+    const auto address = detail::function_address(f);
+    if (const auto it = detail::lower_bound_function(table->entries, address); it != table->entries.end() && it->address == address) {
+      return it->name;
+    }
+  }
+  return string_view{""};
+}
+#endif
+
+#if defined(NAMEOF_TYPE_RTTI_SUPPORTED) && NAMEOF_TYPE_RTTI_SUPPORTED
+namespace detail {
+
+struct type_name_entry {
+  const std::type_info* type;
+  string_view name;
+};
+
+// Entries are written once under mutex before size is published, readers only load size and scan, without locks and allocations.
+struct type_name_table {
+  std::array<type_name_entry, NAMEOF_TYPE_NAME_TABLE_CAPACITY> entries{};
+  std::atomic<std::size_t> size{0};
+  std::mutex mutex;
+};
+
+inline type_name_table type_names{};
+
+inline const type_name_entry* find_type_name(const std::type_info& type) noexcept {
+  const auto& table = type_names;
+  const auto size = table.size.load(std::memory_order_acquire);
+  for (std::size_t i = 0; i < size; ++i) {
+    if (*table.entries[i].type == type) {
+      return &table.entries[i];
+    }
+  }
+  return nullptr;
+}
+
+inline string_view demangled_type_name(const std::type_info& type) {
+#if __has_include(<cxxabi.h>)
+  auto name = demangle(type.name());
+  return name.p ? string_view{name.p.release()} : name.view(); // Name is owned by table until exit.
+#else
+  return string_view{type.name()};
+#endif
+}
+
+} // namespace nameof::detail
+
+// Registers demangled RTTI name of type, to obtain it later by registered_type_name. Returns false if table is full.
+// Not async-signal-safe, register types at startup.
+inline bool register_type_name(const std::type_info& type) {
+  auto& table = detail::type_names;
+  const std::lock_guard<std::mutex> lock{table.mutex};
+  const auto size = table.size.load(std::memory_order_relaxed);
+  for (std::size_t i = 0; i < size; ++i) {
+    if (*table.entries[i].type == type) {
+      return true;
+    }
+  }
+  if (size == table.entries.size()) {
+    return false;
+  }
+  table.entries[size] = {&type, detail::demangled_type_name(type)};
+  table.size.store(size + 1, std::memory_order_release);
+  return true;
+}
+
+// Registers demangled RTTI names of types. Returns false if table is full.
+template <typename... T>
+bool register_type_names() {
+  return (register_type_name(typeid(T)) && ...);
+}
+
+// Obtains registered demangled RTTI name of type, or raw name of type_info if type is not registered.
+// Async-signal-safe: does not allocate or lock, can be used in signal handler.
+inline string_view registered_type_name(const std::type_info& type) noexcept {
+  if (const auto* entry = detail::find_type_name(type); entry != nullptr) {
+    return entry->name;
+  }
+  return string_view{type.name()};
+}
+
+#if __has_include(<cxxabi.h>)
+namespace detail {
+
+// Cache of demangled names of exception types, separate from registered type names, so exceptions do not take slots of crash handlers.
+// Nodes are pushed under mutex and never freed, readers only load head and scan, without locks.
+struct exception_type_name {
+  const std::type_info* type;
+  string_view name;
+  const exception_type_name* next;
+};
+
+inline std::atomic<const exception_type_name*> exception_type_names{nullptr};
+
+inline std::mutex exception_type_names_mutex;
+
+inline const exception_type_name* find_exception_type_name(const std::type_info& type, const exception_type_name* first) noexcept {
+  for (auto* entry = first; entry != nullptr; entry = entry->next) {
+    if (*entry->type == type) {
+      return entry;
+    }
+  }
+  return nullptr;
+}
+
+inline string_view cache_exception_type_name(const std::type_info& type) {
+  const std::lock_guard<std::mutex> lock{exception_type_names_mutex};
+  const auto* head = exception_type_names.load(std::memory_order_relaxed);
+  if (const auto* entry = find_exception_type_name(type, head); entry != nullptr) {
+    return entry->name;
+  }
+  const auto* entry = new exception_type_name{&type, demangled_type_name(type), head};
+  exception_type_names.store(entry, std::memory_order_release);
+  return entry->name;
+}
+
+} // namespace nameof::detail
+
+// Obtains demangled name of type of current exception, or empty string_view if there is no current exception.
+// Demangled name of each exception type is cached, so repeated types do not allocate.
+inline string_view nameof_current_exception_type() {
+  const auto* type = abi::__cxa_current_exception_type();
+  if (type == nullptr) {
+    return string_view{""};
+  }
+  if (const auto* entry = detail::find_exception_type_name(*type, detail::exception_type_names.load(std::memory_order_acquire)); entry != nullptr) {
+    return entry->name;
+  }
+  return detail::cache_exception_type_name(*type);
+}
+
+// Obtains demangled short name of type of current exception, or empty string_view if there is no current exception.
+inline string_view nameof_short_current_exception_type() {
+  return detail::pretty_name(nameof_current_exception_type());
+}
+#endif
+#endif
+
+} // namespace nameof
+
+#if defined(NAMEOF_TYPE_RTTI_SUPPORTED) && NAMEOF_TYPE_RTTI_SUPPORTED
+// Obtains registered demangled RTTI name of type of expression, async-signal-safe.
+#  define NAMEOF_TYPE_RTTI_REGISTERED(...) ::nameof::registered_type_name(typeid(__VA_ARGS__))
+#endif
+
+#if defined(NAMEOF_POINTER_SUPPORTED) && NAMEOF_POINTER_SUPPORTED
+#  define NAMEOF_REGISTRY_CONCAT_IMPL(a, b) a##b
+#  define NAMEOF_REGISTRY_CONCAT(a, b) NAMEOF_REGISTRY_CONCAT_IMPL(a, b)
+
+// Registers names of functions at static initialization, use at namespace scope of a single .cpp file, in a header it registers again in each translation unit.
+#  define NAMEOF_REGISTER_FUNCTIONS(...) [[maybe_unused]] static const bool NAMEOF_REGISTRY_CONCAT(nameof_registered_functions_, __LINE__) = (::nameof::register_function_names<__VA_ARGS__>(), true)
+#endif
+
+#endif // NEARGYE_NAMEOF_REGISTRY_HPP
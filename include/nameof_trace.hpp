@@ -0,0 +1,165 @@
+//  _   _                             __    _____
+// | \ | |                           / _|  / ____|_     _
+// |  \| | __ _ _ __ ___   ___  ___ | |_  | |   _| |_ _| |_
+// | . ` |/ _` | '_ ` _ \ / _ \/ _ \|  _| | |  |_   _|_   _|
+// | |\  | (_| | | | | | |  __/ (_) | |   | |____|_|   |_|
+// |_| \_|\__,_|_| |_| |_|\___|\___/|_|    \_____|
+// https://github.com/Neargye/nameof
+// version 0.10.6
+//
+// Licensed under the MIT License <http://opensource.org/licenses/MIT>.
+// SPDX-License-Identifier: MIT
+// Copyright (c) 2026 Daniil Goncharov <neargye@gmail.com>.
+//
+// Permission is hereby  granted, free of charge, to any  person obtaining a copy
+// of this software and associated  documentation files (the "Software"), to deal
+// in the Software  without restriction, including without  limitation the rights
+// to  use, copy,  modify, merge,  publish, distribute,  sublicense, and/or  sell
+// copies  of  the Software,  and  to  permit persons  to  whom  the Software  is
+// furnished to do so, subject to the following conditions:
+//
+// The above copyright notice and this permission notice shall be included in all
+// copies or substantial portions of the Software.
+//
+// THE SOFTWARE  IS PROVIDED "AS  IS", WITHOUT WARRANTY  OF ANY KIND,  EXPRESS OR
+// IMPLIED,  INCLUDING BUT  NOT  LIMITED TO  THE  WARRANTIES OF  MERCHANTABILITY,
+// FITNESS FOR  A PARTICULAR PURPOSE AND  NONINFRINGEMENT. IN NO EVENT  SHALL THE
+// AUTHORS  OR COPYRIGHT  HOLDERS  BE  LIABLE FOR  ANY  CLAIM,  DAMAGES OR  OTHER
+// LIABILITY, WHETHER IN AN ACTION OF  CONTRACT, TORT OR OTHERWISE, ARISING FROM,
+// OUT OF OR IN CONNECTION WITH THE SOFTWARE  OR THE USE OR OTHER DEALINGS IN THE
+// SOFTWARE.
+
+#ifndef NEARGYE_NAMEOF_TRACE_HPP
+#define NEARGYE_NAMEOF_TRACE_HPP
+
+#include "nameof.hpp"
+
+#include <array>
+#include <atomic>
+#include <chrono>
+#include <cstddef>
+#include <cstdint>
+
+// Number of entries in trace buffer of each thread, must be power of 2. By default NAMEOF_TRACE_CAPACITY = 256.
+// If need another capacity, redefine the macro NAMEOF_TRACE_CAPACITY.
+#if !defined(NAMEOF_TRACE_CAPACITY)
+#  define NAMEOF_TRACE_CAPACITY 256
+#endif
+
+// Timestamp of trace entry. By default ticks of std::chrono::steady_clock.
+// If need another clock (e.g. __rdtsc()), redefine the macro NAMEOF_TRACE_TIMESTAMP.
+#if !defined(NAMEOF_TRACE_TIMESTAMP)
+#  define NAMEOF_TRACE_TIMESTAMP() static_cast<::std::uint64_t>(::std::chrono::steady_clock::now().time_since_epoch().count())
+#endif
+
+namespace nameof {
+
+static_assert(NAMEOF_TRACE_CAPACITY > 0 && (NAMEOF_TRACE_CAPACITY & (NAMEOF_TRACE_CAPACITY - 1)) == 0, "NAMEOF_TRACE_CAPACITY must be power of 2.");
+
+// Entry of trace, name is resolved by descriptor only on read.
+struct trace_entry {
+  const enum_descriptor* descriptor;
+  std::uint64_t value;
+  std::uint64_t timestamp;
+
+  [[nodiscard]] string_view type_name() const noexcept { return descriptor->type_name(); }
+
+  [[nodiscard]] string_view name() const noexcept { return descriptor->name(value); }
+};
+
+namespace detail {
+
+// Ring buffer of trace entries of one thread. Buffers are never freed, a buffer of exited thread keeps its entries until it is reused by a new thread.
+struct trace_buffer {
+  std::array<trace_entry, NAMEOF_TRACE_CAPACITY> entries{};
+  std::atomic<std::uint64_t> head{0};
+  std::atomic<bool> used{true};
+  trace_buffer* next{nullptr};
+
+  void push(const enum_descriptor* descriptor, std::uint64_t value, std::uint64_t timestamp) noexcept {
+    const auto h = head.load(std::memory_order_relaxed);
+    entries[h & (NAMEOF_TRACE_CAPACITY - 1)] = {descriptor, value, timestamp};
+    head.store(h + 1, std::memory_order_release);
+  }
+
+  // Calls f for entries recorded since start, at most NAMEOF_TRACE_CAPACITY newest.
+  template <typename F>
+  void for_each(F& f, std::uint64_t start = 0) const {
+    const auto h = head.load(std::memory_order_acquire);
+    const auto first = h - start > NAMEOF_TRACE_CAPACITY ? h - NAMEOF_TRACE_CAPACITY : start;
+    for (auto i = first; i < h; ++i) {
+      f(entries[i & (NAMEOF_TRACE_CAPACITY - 1)]);
+    }
+  }
+};
+
+inline std::atomic<trace_buffer*> trace_buffers{nullptr};
+
+inline trace_buffer* acquire_trace_buffer() {
+  for (auto* buffer = trace_buffers.load(std::memory_order_acquire); buffer != nullptr; buffer = buffer->next) {
+    if (bool expected = false; buffer->used.compare_exchange_strong(expected, true, std::memory_order_acq_rel)) {
+      return buffer;
+    }
+  }
+
+  auto* buffer = new trace_buffer{};
+  buffer->next = trace_buffers.load(std::memory_order_relaxed);
+  while (!trace_buffers.compare_exchange_weak(buffer->next, buffer, std::memory_order_release, std::memory_order_relaxed)) {
+  }
+  return buffer;
+}
+
+// Reused buffer keeps entries of exited thread, start is head at acquisition, so current thread reads only its own entries.
+struct trace_buffer_owner {
+  trace_buffer* buffer = acquire_trace_buffer();
+  std::uint64_t start = buffer->head.load(std::memory_order_relaxed);
+
+  ~trace_buffer_owner() { buffer->used.store(false, std::memory_order_release); }
+};
+
+inline trace_buffer_owner& this_thread_trace_owner() {
+  thread_local trace_buffer_owner owner;
+  return owner;
+}
+
+inline trace_buffer& this_thread_trace_buffer() {
+  return *this_thread_trace_owner().buffer;
+}
+
+} // namespace nameof::detail
+
+// Acquires trace buffer of current thread ahead of the first record. May allocate and retry CAS while registering new buffer.
+inline void trace_thread_init() {
+  static_cast<void>(detail::this_thread_trace_buffer());
+}
+
+// Records enum value to trace buffer of current thread, names are not resolved.
+// Wait-free after buffer of current thread is acquired by trace_thread_init or first record, which may allocate.
+template <typename E>
+auto trace(E value) -> detail::enable_if_enum_t<E, void> {
+  using D = std::decay_t<E>;
+  detail::this_thread_trace_buffer().push(&enum_descriptor_of<D>(), detail::erase_value<D>(value), NAMEOF_TRACE_TIMESTAMP());
+}
+
+// Calls f(const trace_entry&) for each entry of trace of current thread, from oldest to newest.
+template <typename F>
+void trace_for_each(F&& f) {
+  const auto& owner = detail::this_thread_trace_owner();
+  owner.buffer->for_each(f, owner.start);
+}
+
+// Calls f(const trace_entry&) for each entry of traces of all threads, including exited threads, each trace from oldest to newest.
+// Entries being recorded concurrently may be torn, dump when recording threads are stopped (e.g. from crash handler).
+template <typename F>
+void trace_for_each_thread(F&& f) {
+  for (auto* buffer = detail::trace_buffers.load(std::memory_order_acquire); buffer != nullptr; buffer = buffer->next) {
+    buffer->for_each(f);
+  }
+}
+
+} // namespace nameof
+
+// Records enum value to trace buffer of current thread.
+#define NAMEOF_TRACE(...) ::nameof::trace(__VA_ARGS__)
+
+#endif // NEARGYE_NAMEOF_TRACE_HPP
@@ -23,11 +23,15 @@
 #define DOCTEST_CONFIG_IMPLEMENT_WITH_MAIN
 #include <doctest/doctest.h>
 
+#include <algorithm>
+#include <iomanip>
+#include <optional>
 #include <string>
 #include <string_view>
 #include <sstream>
 #include <stdexcept>
 #include <type_traits>
+#include <vector>
 
 #if __has_include(<fmt/format.h>)
 #  include <fmt/format.h>
@@ -118,6 +122,10 @@ enum AnimalFlags {
   Endangered = 8,
 };
 
+enum class TcpFlags : std::uint8_t { FIN = 1, SYN = 2, RST = 4, PSH = 8, ACK = 16, URG = 32, ECE = 64, CWR = 128 };
+
+enum class GapFlags { A = 4, C = 16 };
+
 enum class BigFlags : std::uint64_t {
   A = 1,
   B = (static_cast<std::uint64_t>(0x1) << 20),
@@ -133,6 +141,14 @@ struct nameof::customize::enum_range<number> {
   static_assert(max > min, "nameof::enum_range<number> requires max > min.");
 };
 
+enum class WideRange : short { Low = -2100, Mid = 0, High = 2100 };
+
+template <>
+struct nameof::customize::enum_range<WideRange> {
+  static constexpr int min = -2100;
+  static constexpr int max = 2100;
+};
+
 enum class OutOfRange {
   too_low = NAMEOF_ENUM_RANGE_MIN - 1,
   required_to_work = 0,
@@ -146,7 +162,16 @@ enum class EntirelyOutOfRange {
 
 enum class CustomEnum { default_name = 1, custom_name = 2 };
 
+enum ErrorCode { ERRC_OK = 0, ERRC_TIMEOUT = 1, ERRC_CONNECTION_RESET = 2, ERRC_ = 3 };
+
+enum class Tint { kRed = 1, kGreen = 2, kBlue_e = 4 };
+
+enum class Perm { PermRead_f = 1, PermWrite_f = 2 };
+
+enum class NameStyle { HttpServer = 1, HTTPServer, lower_snake, UPPER_SNAKE, Ipv4Address, X };
+
 namespace {
+struct HiddenStruct { int hidden_field; };
 enum class HiddenEnum { A = 1 };
 namespace {
 enum class NestedHiddenEnum { A = 1 };
@@ -169,6 +194,43 @@ constexpr nameof::string_view nameof::customize::enum_name<CustomEnum>(CustomEnu
   }
 }
 
+template <>
+constexpr nameof::string_view nameof::customize::enum_prefix<ErrorCode>() noexcept {
+  return "ERRC_";
+}
+
+template <>
+constexpr nameof::string_view nameof::customize::enum_prefix<Tint>() noexcept {
+  return "k";
+}
+
+template <>
+constexpr nameof::string_view nameof::customize::enum_suffix<Tint>() noexcept {
+  return "_e";
+}
+
+template <>
+struct nameof::customize::enum_format<Color> : std::true_type {};
+
+template <>
+struct nameof::customize::enum_format<AnimalFlags> : std::true_type {};
+
+template <>
+struct nameof::customize::enum_format<BigFlags> : std::true_type {};
+
+template <>
+struct nameof::customize::enum_format<GapFlags> : std::true_type {};
+
+template <>
+constexpr nameof::string_view nameof::customize::enum_prefix<Perm>() noexcept {
+  return "Perm";
+}
+
+template <>
+constexpr nameof::string_view nameof::customize::enum_suffix<Perm>() noexcept {
+  return "_f";
+}
+
 #if defined(NAMEOF_ENUM_SUPPORTED)
 static_assert(nameof::detail::is_valid<Color, -12>(), "nameof::detail::is_valid requires valid enum values.");
 static_assert(!nameof::detail::is_valid<Color, 0>(), "nameof::detail::is_valid requires invalid enum values.");
@@ -416,6 +478,14 @@ TEST_CASE("CSTRING") {
         std::ostringstream os;
         os << cstring_N;
         REQUIRE(os.str() == content);
+
+        std::ostringstream padded;
+        padded << std::setw(10) << std::setfill('*') << cstring_N << '|' << std::left << std::setw(9) << cstring_N << '|' << std::setw(3) << cstring_N;
+        REQUIRE(padded.str() == "***content|content**|content");
+
+        std::wostringstream wos;
+        wos << std::setw(8) << cstring_N;
+        REQUIRE(wos.str() == L" content");
     }
 }
 
@@ -481,6 +551,8 @@ TEST_CASE("CSTRING_0") {
         std::ostringstream os;
         os << cstring_0;
         REQUIRE(os.str().empty());
+        os << std::setw(3) << cstring_0 << cstring_0;
+        REQUIRE(os.str() == "   ");
     }
 }
 
@@ -513,6 +585,93 @@ TEST_CASE("CSTRING_FORMAT") {
 #endif
 }
 
+TEST_CASE("ENUM_FORMAT") {
+#if defined(NAMEOF_TEST_HAS_STD_FORMAT)
+  SUBCASE("std::format") {
+    REQUIRE(std::format("{}", Color::RED) == "RED");
+    REQUIRE(std::format("{:d}", Color::RED) == "-12");
+    REQUIRE(std::format("{:x}", Color::BLUE) == "f");
+    REQUIRE(std::format("{}", static_cast<Color>(100)) == "100");
+    REQUIRE(std::format("{:f}", static_cast<AnimalFlags>(HasClaws | CanFly)) == "HasClaws|CanFly");
+    REQUIRE(std::format("{}", static_cast<AnimalFlags>(HasClaws | CanFly)) == "3");
+    REQUIRE(std::format("{:f}", static_cast<GapFlags>(8)) == "8");
+  }
+#endif
+
+#if defined(NAMEOF_TEST_HAS_FMT_FORMAT)
+  SUBCASE("fmt::format") {
+    REQUIRE(fmt::format("{}", Color::RED) == "RED");
+    REQUIRE(fmt::format("{:d}", Color::RED) == "-12");
+    REQUIRE(fmt::format("{:x}", Color::BLUE) == "f");
+    REQUIRE(fmt::format("{}", static_cast<Color>(100)) == "100");
+    REQUIRE(fmt::format("{:f}", static_cast<AnimalFlags>(HasClaws | CanFly)) == "HasClaws|CanFly");
+    REQUIRE(fmt::format("{}", static_cast<AnimalFlags>(HasClaws | CanFly)) == "3");
+    REQUIRE(fmt::format("{:f}", static_cast<GapFlags>(8)) == "8");
+    REQUIRE(fmt::format("{:x}", BigFlags::D) == "8000000000000000");
+    REQUIRE_THROWS_AS(static_cast<void>(fmt::format(fmt::runtime("{:s}"), Color::RED)), fmt::format_error);
+  }
+#endif
+}
+
+TEST_CASE("ENUM_STREAM") {
+  std::ostringstream os;
+  os << nameof::as_name(Color::RED) << ' ' << nameof::as_name(static_cast<Color>(100)) << '|';
+  os << std::setw(6) << nameof::as_name(Color::BLUE) << '|' << std::left << std::setw(6) << nameof::as_name(Color::BLUE) << '|';
+  REQUIRE(os.str() == "RED |  BLUE|BLUE  |");
+
+  std::ostringstream flags;
+  flags << nameof::as_flag_name(static_cast<AnimalFlags>(HasClaws | CanFly)) << ' ' << nameof::as_flag_name(static_cast<AnimalFlags>(CanFly | Endangered), ',');
+  flags << '|' << nameof::as_flag_name(static_cast<AnimalFlags>(0)) << nameof::as_flag_name(static_cast<GapFlags>(8)) << '|';
+  flags << std::setfill('.') << std::setw(10) << nameof::as_flag_name(BigFlags::D);
+  REQUIRE(flags.str() == "HasClaws|CanFly CanFly,Endangered||.........D");
+
+  std::wostringstream wos;
+  wos << nameof::as_name(Color::GREEN) << L' ' << nameof::as_flag_name(static_cast<AnimalFlags>(HasClaws | EatsFish));
+  REQUIRE(wos.str() == L"GREEN HasClaws|EatsFish");
+}
+
+TEST_CASE("CSTRING_HASH") {
+  constexpr auto empty = ::nameof::cstring<0>{};
+  constexpr auto a = ::nameof::cstring<1>{"a"};
+  constexpr auto name = NAMEOF(othervar);
+  static_assert(empty.hash() == 0xcbf29ce484222325);
+  static_assert(a.hash() == 0xaf63dc4c8601ec8c);
+  static_assert(name.hash() == ::nameof::detail::hash("othervar"));
+  static_assert(NAMEOF(othervar).hash() != NAMEOF(struct_var).hash());
+
+  REQUIRE(std::hash<::nameof::cstring<0>>{}(empty) == static_cast<std::size_t>(empty.hash()));
+  REQUIRE(std::hash<::nameof::cstring<1>>{}(a) == static_cast<std::size_t>(a.hash()));
+  REQUIRE(std::hash<std::decay_t<decltype(name)>>{}(name) == static_cast<std::size_t>(name.hash()));
+}
+
+TEST_CASE("CSTRING_CONCAT") {
+  constexpr auto lhs = ::nameof::cstring<4>{"Type"};
+  constexpr auto rhs = ::nameof::cstring<6>{"member"};
+  constexpr auto empty = ::nameof::cstring<0>{};
+
+  constexpr auto key = lhs + "::" + rhs;
+  static_assert(std::is_same_v<decltype(key), const ::nameof::cstring<12>>);
+  static_assert(key == "Type::member");
+  static_assert(key.hash() == ::nameof::detail::hash("Type::member"));
+  require_cstring_contract(key, "Type::member");
+
+  static_assert(lhs + rhs == "Typemember");
+  static_assert("Enum." + rhs == "Enum.member");
+  static_assert(lhs + empty == "Type");
+  static_assert(empty + rhs == "member");
+  static_assert((empty + empty).empty());
+  static_assert((empty + "").empty());
+
+  static_assert(NAMEOF(othervar) + "." + NAMEOF(struct_var.somefield) == "othervar.somefield");
+
+  static_assert(rhs.substr<0, 3>() == "mem");
+  static_assert(rhs.substr<3>() == "ber");
+  static_assert(rhs.substr<6>().empty());
+  static_assert(std::is_same_v<decltype(rhs.substr<2, 2>()), ::nameof::cstring<2>>);
+  static_assert(empty.substr<0>().empty());
+  require_cstring_contract(rhs.substr<1, 3>(), "emb");
+}
+
 TEST_CASE("NAMEOF_FULL") {
   SUBCASE("variable") {
     constexpr auto full_name = NAMEOF_FULL(othervar);
@@ -736,6 +895,267 @@ TEST_CASE("nameof_enum_flag") {
   NAMEOF_DEBUG_REQUIRE(nameof::nameof_enum_flag(static_cast<BigFlags>((static_cast<std::uint64_t>(0x1) << 63) | 2)).empty());
 }
 
+TEST_CASE("nameof_enum_or_number") {
+  char buffer[32];
+  const auto red = nameof::nameof_enum_or_number(Color::RED, buffer);
+  REQUIRE(red == "RED");
+  REQUIRE(red.data() == nameof::nameof_enum(Color::RED).data());
+
+#if defined(NAMEOF_TYPE_SUPPORTED) && !defined(_MSC_VER)
+  const auto unknown = nameof::nameof_enum_or_number(static_cast<Color>(417), buffer);
+  REQUIRE(unknown == "Color(417)");
+  REQUIRE(unknown.data() == buffer);
+  REQUIRE(nameof::nameof_enum_or_number(static_cast<Numbers>(-7), buffer, sizeof(buffer)) == "Numbers(-7)");
+  REQUIRE(nameof::nameof_enum_or_number(static_cast<number>(7), buffer, sizeof(buffer)) == "number(7)");
+  REQUIRE(nameof::nameof_enum_or_number(static_cast<BigFlags>(3), buffer) == "BigFlags(3)");
+
+  char small[10];
+  REQUIRE(nameof::nameof_enum_or_number(static_cast<Color>(41), small) == "Color(41)");
+  REQUIRE(nameof::nameof_enum_or_number(static_cast<Color>(417), small) == "Color(417)");
+  REQUIRE(nameof::nameof_enum_or_number(static_cast<Color>(4170), small).empty());
+  REQUIRE(nameof::nameof_enum_or_number(static_cast<Color>(417), buffer, 6).empty());
+#endif
+}
+
+TEST_CASE("nameof_enum_flag static storage") {
+  constexpr auto& af = nameof::nameof_enum_flag<static_cast<AnimalFlags>(HasClaws | EatsFish)>();
+  static_assert(std::is_same_v<decltype(af), const nameof::cstring<17>&>);
+  static_assert(af == "HasClaws|EatsFish");
+  static_assert(nameof::nameof_enum_flag<AnimalFlags::Endangered>() == "Endangered");
+  static_assert(nameof::nameof_enum_flag<static_cast<AnimalFlags>(CanFly | Endangered), ','>() == "CanFly,Endangered");
+  static_assert(NAMEOF_ENUM_FLAG_CONST(static_cast<AnimalFlags>(1 | 2 | 4 | 8)) == "HasClaws|CanFly|EatsFish|Endangered");
+  static_assert(NAMEOF_ENUM_FLAG_CONST(static_cast<Perm>(3)) == "Read|Write");
+
+  static_assert(NAMEOF_ENUM_FLAG_CONST(static_cast<BigFlags>(1 | (static_cast<std::uint64_t>(0x1) << 63))) == "A|D");
+  static_assert(NAMEOF_ENUM_FLAG_CONST(static_cast<BigFlags>(static_cast<std::uint64_t>(0x1) << 40)) == "C");
+
+  static_assert(std::is_same_v<decltype(NAMEOF_ENUM_FLAG_CONST(static_cast<AnimalFlags>(0))), const nameof::cstring<0>&>);
+  static_assert(NAMEOF_ENUM_FLAG_CONST(static_cast<AnimalFlags>(1 | 16)).empty());
+  static_assert(NAMEOF_ENUM_FLAG_CONST(static_cast<BigFlags>(1 | 2)).empty());
+  static_assert(NAMEOF_ENUM_FLAG_CONST(static_cast<GapFlags>(-1)).empty());
+}
+
+TEST_CASE("nameof_enum_flag_view") {
+  constexpr auto af = nameof::nameof_enum_flag_view(AnimalFlags::HasClaws);
+  static_assert(af == "HasClaws");
+  REQUIRE(nameof::nameof_enum_flag_view(static_cast<AnimalFlags>(1 | 2)) == "HasClaws|CanFly");
+  REQUIRE(nameof::nameof_enum_flag_view(static_cast<AnimalFlags>(1 | 2 | 4 | 8)) == "HasClaws|CanFly|EatsFish|Endangered");
+  REQUIRE(nameof::nameof_enum_flag_view<','>(static_cast<AnimalFlags>(2 | 8)) == "CanFly,Endangered");
+  REQUIRE(nameof::nameof_enum_flag_view(static_cast<AnimalFlags>(0)).empty());
+  REQUIRE(nameof::nameof_enum_flag_view(static_cast<AnimalFlags>(1 | 16)).empty());
+
+  for (int i = 0; i < 256; ++i) {
+    const auto v = static_cast<TcpFlags>(i);
+    REQUIRE(nameof::nameof_enum_flag_view(v) == nameof::string_view{nameof::nameof_enum_flag(v)});
+  }
+  REQUIRE(nameof::nameof_enum_flag_view(static_cast<TcpFlags>(2 | 16)) == "SYN|ACK");
+
+  REQUIRE(nameof::nameof_enum_flag_view(static_cast<GapFlags>(4 | 16)) == "A|C");
+  REQUIRE(nameof::nameof_enum_flag_view(GapFlags::C) == "C");
+  REQUIRE(nameof::nameof_enum_flag_view(static_cast<GapFlags>(8)).empty());
+  REQUIRE(nameof::nameof_enum_flag_view(static_cast<GapFlags>(1 | 4)).empty());
+  REQUIRE(nameof::nameof_enum_flag_view(static_cast<GapFlags>(4 | 32)).empty());
+}
+
+TEST_CASE("enum_contains") {
+  static_assert(nameof::enum_contains<Color>(-12));
+  static_assert(!nameof::enum_contains<Color>(0));
+  REQUIRE(nameof::enum_contains<Color>(7));
+  REQUIRE(nameof::enum_contains<Color>(15L));
+  REQUIRE_FALSE(nameof::enum_contains<Color>(16));
+  REQUIRE_FALSE(nameof::enum_contains<Color>(-13));
+
+  REQUIRE(nameof::enum_contains<ErrorCode>(3u));
+  REQUIRE_FALSE(nameof::enum_contains<ErrorCode>(4));
+  REQUIRE_FALSE(nameof::enum_contains<ErrorCode>(-1));
+
+  REQUIRE(nameof::enum_contains<number>(200));
+  REQUIRE_FALSE(nameof::enum_contains<number>(-200));
+  REQUIRE_FALSE(nameof::enum_contains<number>(150));
+
+  REQUIRE(nameof::enum_contains<TcpFlags>(1));
+  REQUIRE_FALSE(nameof::enum_contains<TcpFlags>(257));
+  REQUIRE_FALSE(nameof::enum_contains<TcpFlags>(-255));
+
+  static_assert(!nameof::detail::is_contains_bitset_v<WideRange>);
+  REQUIRE(nameof::enum_contains<WideRange>(-2100));
+  REQUIRE(nameof::enum_contains<WideRange>(0));
+  REQUIRE(nameof::enum_contains<WideRange>(2100));
+  REQUIRE_FALSE(nameof::enum_contains<WideRange>(1));
+  REQUIRE_FALSE(nameof::enum_contains<WideRange>(65536));
+
+  for (int i = -130; i <= 130; ++i) {
+    REQUIRE(nameof::enum_contains<Directions>(i) == !nameof::nameof_enum(static_cast<Directions>(i)).empty());
+  }
+}
+
+TEST_CASE("enum_flags_contains") {
+  static_assert(nameof::enum_flags_contains<AnimalFlags>(HasClaws | EatsFish));
+  REQUIRE(nameof::enum_flags_contains<AnimalFlags>(15));
+  REQUIRE_FALSE(nameof::enum_flags_contains<AnimalFlags>(0));
+  REQUIRE_FALSE(nameof::enum_flags_contains<AnimalFlags>(16));
+  REQUIRE_FALSE(nameof::enum_flags_contains<AnimalFlags>(-1));
+
+  REQUIRE(nameof::enum_flags_contains<TcpFlags>(0xFF));
+  REQUIRE_FALSE(nameof::enum_flags_contains<TcpFlags>(0x100));
+
+  REQUIRE(nameof::enum_flags_contains<GapFlags>(20));
+  REQUIRE_FALSE(nameof::enum_flags_contains<GapFlags>(8));
+
+  REQUIRE(nameof::enum_flags_contains<BigFlags>(static_cast<std::uint64_t>(BigFlags::A) | static_cast<std::uint64_t>(BigFlags::D)));
+  REQUIRE_FALSE(nameof::enum_flags_contains<BigFlags>(2u));
+}
+
+TEST_CASE("enum_name_rank") {
+  static_assert(nameof::enum_name_rank(Color::BLUE) == 0);
+  static_assert(nameof::enum_name_rank(Color::GREEN) == 1);
+  static_assert(nameof::enum_name_rank(Color::RED) == 2);
+  REQUIRE(nameof::enum_name_rank(static_cast<Color>(0)) == 3);
+
+  REQUIRE(nameof::enum_name_rank(Down) == 0);
+  REQUIRE(nameof::enum_name_rank(Left) == 1);
+  REQUIRE(nameof::enum_name_rank(Right) == 2);
+  REQUIRE(nameof::enum_name_rank(Up) == 3);
+
+  std::vector<TcpFlags> flags = {TcpFlags::SYN, TcpFlags::URG, TcpFlags::ACK, TcpFlags::FIN, TcpFlags::RST, TcpFlags::PSH, TcpFlags::ECE};
+  std::sort(flags.begin(), flags.end(), [](TcpFlags lhs, TcpFlags rhs) { return nameof::enum_name_rank(lhs) < nameof::enum_name_rank(rhs); });
+  for (std::size_t i = 1; i < flags.size(); ++i) {
+    REQUIRE(nameof::nameof_enum(flags[i - 1]) < nameof::nameof_enum(flags[i]));
+  }
+}
+
+TEST_CASE("nameof_enum_hash") {
+  static_assert(nameof::nameof_enum_hash(Color::RED) == nameof::detail::hash("RED"));
+  static_assert(nameof::nameof_enum_hash(Color::GREEN) == nameof::nameof_enum<Color::GREEN>().hash());
+  REQUIRE(nameof::nameof_enum_hash(Color::BLUE) == nameof::detail::hash("BLUE"));
+  REQUIRE(nameof::nameof_enum_hash(Numbers::three) == nameof::detail::hash("three"));
+  REQUIRE(nameof::nameof_enum_hash(Directions::Left) == nameof::detail::hash("Left"));
+  REQUIRE(nameof::nameof_enum_hash(number::two) == nameof::detail::hash("two"));
+  REQUIRE(nameof::nameof_enum_hash(CustomEnum::custom_name) == nameof::detail::hash("custom enum"));
+  REQUIRE(nameof::nameof_enum_hash(static_cast<Color>(0)) == nameof::detail::hash(""));
+  REQUIRE(nameof::nameof_enum_hash(static_cast<number>(0)) == nameof::detail::hash(""));
+}
+
+TEST_CASE("nameof_enum style") {
+  using nameof::style;
+  static_assert(nameof::nameof_enum<NameStyle, style::snake>(NameStyle::HttpServer) == "http_server");
+  REQUIRE(nameof::nameof_enum<NameStyle, style::snake>(NameStyle::HTTPServer) == "http_server");
+  REQUIRE(nameof::nameof_enum<NameStyle, style::snake>(NameStyle::lower_snake) == "lower_snake");
+  REQUIRE(nameof::nameof_enum<NameStyle, style::snake>(NameStyle::UPPER_SNAKE) == "upper_snake");
+  REQUIRE(nameof::nameof_enum<NameStyle, style::snake>(NameStyle::Ipv4Address) == "ipv4_address");
+  REQUIRE(nameof::nameof_enum<NameStyle, style::snake>(NameStyle::X) == "x");
+
+  REQUIRE(nameof::nameof_enum<NameStyle, style::kebab>(NameStyle::HttpServer) == "http-server");
+  REQUIRE(nameof::nameof_enum<NameStyle, style::kebab>(NameStyle::UPPER_SNAKE) == "upper-snake");
+
+  REQUIRE(nameof::nameof_enum<NameStyle, style::camel>(NameStyle::HttpServer) == "httpServer");
+  REQUIRE(nameof::nameof_enum<NameStyle, style::camel>(NameStyle::HTTPServer) == "httpServer");
+  REQUIRE(nameof::nameof_enum<NameStyle, style::camel>(NameStyle::lower_snake) == "lowerSnake");
+  REQUIRE(nameof::nameof_enum<NameStyle, style::camel>(NameStyle::UPPER_SNAKE) == "upperSnake");
+
+  REQUIRE(nameof::nameof_enum<NameStyle, style::lower>(NameStyle::HTTPServer) == "httpserver");
+  REQUIRE(nameof::nameof_enum<NameStyle, style::upper>(NameStyle::lower_snake) == "LOWER_SNAKE");
+
+  REQUIRE(nameof::nameof_enum<Color, style::lower>(Color::GREEN) == "green");
+  REQUIRE(nameof::nameof_enum<Directions, style::upper>(Directions::Left) == "LEFT");
+  REQUIRE(nameof::nameof_enum<CustomEnum, style::snake>(CustomEnum::custom_name) == "custom enum");
+  require_string_view_contract(nameof::nameof_enum<NameStyle, style::snake>(NameStyle::HttpServer), "http_server");
+  REQUIRE(nameof::nameof_enum<Color, style::snake>(static_cast<Color>(0)).empty());
+}
+
+TEST_CASE("nameof_enum prefix and suffix") {
+  static_assert(nameof::nameof_enum(ErrorCode::ERRC_TIMEOUT) == "TIMEOUT");
+  REQUIRE(nameof::nameof_enum(ErrorCode::ERRC_OK) == "OK");
+  REQUIRE(nameof::nameof_enum(ErrorCode::ERRC_CONNECTION_RESET) == "CONNECTION_RESET");
+  REQUIRE(nameof::nameof_enum(ErrorCode::ERRC_) == "ERRC_");
+  REQUIRE(NAMEOF_ENUM_CONST(ErrorCode::ERRC_TIMEOUT) == "TIMEOUT");
+  require_string_view_contract(nameof::nameof_enum(ErrorCode::ERRC_TIMEOUT), "TIMEOUT");
+  REQUIRE(nameof::nameof_enum<ErrorCode, nameof::style::snake>(ErrorCode::ERRC_CONNECTION_RESET) == "connection_reset");
+
+  REQUIRE(nameof::nameof_enum(Tint::kRed) == "Red");
+  REQUIRE(nameof::nameof_enum(Tint::kGreen) == "Green");
+  REQUIRE(nameof::nameof_enum(Tint::kBlue_e) == "Blue");
+  REQUIRE(nameof::nameof_enum_flag(static_cast<Perm>(3)) == "Read|Write");
+}
+
+template <Color V>
+constexpr int color_handler() {
+  return static_cast<int>(V) * 2;
+}
+
+TEST_CASE("enum_switch") {
+  const auto visitor = [](auto v) { return color_handler<decltype(v)::value>(); };
+  const auto fallback = []() { return -1; };
+  static_assert(nameof::enum_switch(Color::RED, visitor, fallback) == -24);
+  REQUIRE(nameof::enum_switch(Color::GREEN, visitor, fallback) == 14);
+  REQUIRE(nameof::enum_switch(Color::BLUE, visitor, fallback) == 30);
+  REQUIRE(nameof::enum_switch(static_cast<Color>(0), visitor, fallback) == -1);
+  REQUIRE(nameof::enum_switch(static_cast<Color>(100), visitor, fallback) == -1);
+
+  REQUIRE(nameof::enum_switch(static_cast<Directions>(1), [](auto) { return 0; }, [](Directions d) { return static_cast<int>(d); }) == 1);
+  REQUIRE(nameof::enum_switch(Directions::Left, [](auto v) { return static_cast<int>(v.value); }, [](Directions) { return 0; }) == -120);
+
+  const auto name = nameof::enum_switch(number::two, [](auto v) -> std::string_view { return nameof::nameof_enum<decltype(v)::value>(); }, []() { return std::string_view{}; });
+  REQUIRE(name == "two");
+  REQUIRE(nameof::enum_switch(number::four, [](auto v) { return static_cast<unsigned long>(v.value); }, []() { return 0ul; }) == 0);
+
+  int calls = 0;
+  nameof::enum_switch(Numbers::three, [&calls](auto v) { calls += v.value == Numbers::three ? 1 : 100; }, [&calls]() { calls += 10; });
+  nameof::enum_switch(Numbers::many, [&calls](auto) { ++calls; }, [&calls]() { calls += 10; });
+  REQUIRE(calls == 11);
+
+  static_assert(!nameof::detail::is_range_table_v<WideRange>);
+  const auto wide = [](auto v) { return static_cast<int>(v.value); };
+  REQUIRE(nameof::enum_switch(WideRange::High, wide, [](WideRange) { return 1; }) == 2100);
+  REQUIRE(nameof::enum_switch(WideRange::Low, wide, [](WideRange) { return 1; }) == -2100);
+  REQUIRE(nameof::enum_switch(static_cast<WideRange>(5), wide, [](WideRange) { return 1; }) == 1);
+}
+
+TEST_CASE("enum_for_each") {
+  std::string names;
+  int sum = 0;
+  nameof::enum_for_each<Color>([&](auto v, const auto& name) {
+    REQUIRE(nameof::nameof_enum(v.value) == nameof::string_view{name});
+    sum += static_cast<int>(v.value);
+    names.append(name.data(), name.size()).append(1, ',');
+  });
+  REQUIRE(names == "RED,GREEN,BLUE,");
+  REQUIRE(sum == 10);
+
+  std::size_t count = 0;
+  nameof::enum_for_each<const Directions&>([&count](auto v) {
+    static_assert(std::is_same_v<typename decltype(v)::value_type, Directions>);
+    ++count;
+  });
+  REQUIRE(count == 4);
+
+  constexpr auto total = []() {
+    std::size_t size = 0;
+    nameof::enum_for_each<number>([&size](auto, const auto& name) { size += name.size(); });
+    return size;
+  }();
+  static_assert(total == 11);
+}
+
+TEST_CASE("enum_ref") {
+  static_assert(std::is_trivially_copyable_v<nameof::enum_ref>);
+  static_assert(sizeof(nameof::enum_ref) == sizeof(void*) + sizeof(std::uint64_t));
+
+  constexpr nameof::enum_ref red = Color::RED;
+  static_assert(red.name() == "RED");
+  static_assert(&red.descriptor() == &nameof::enum_descriptor_of<Color>());
+  REQUIRE(red.value() == static_cast<std::uint64_t>(-12));
+  REQUIRE(red.type_name() == nameof::nameof_type<Color>());
+
+  const std::array<nameof::enum_ref, 4> refs = {{Numbers::two, number::three, static_cast<Color>(100), BigFlags::A}};
+  const auto copy = refs;
+  REQUIRE(copy[0].name() == "two");
+  REQUIRE(copy[1].name() == "three");
+  REQUIRE(copy[2].name().empty());
+  REQUIRE(copy[3].name() == "A");
+  REQUIRE(nameof::enum_ref{BigFlags::D}.value() == static_cast<std::uint64_t>(BigFlags::D));
+}
+
 TEST_CASE("NAMEOF_ENUM") {
   constexpr Color cr = Color::RED;
   constexpr auto cr_name = NAMEOF_ENUM(cr);
@@ -1110,6 +1530,48 @@ TEST_CASE("nameof::nameof_short_type") {
   require_cstring_contract(nameof::nameof_short_type<Long::LL>(), "LL");
 }
 
+TEST_CASE("nameof::type_hash") {
+  static_assert(nameof::type_hash<SomeStruct>() == nameof::nameof_type<SomeStruct>().hash());
+  static_assert(nameof::type_hash<const SomeStruct&>() == nameof::type_hash<SomeStruct>());
+  static_assert(nameof::type_hash<SomeStruct>() != nameof::type_hash<Long>());
+  REQUIRE(nameof::type_hash<Long::LL>() == nameof::detail::hash(nameof::nameof_type<Long::LL>()));
+
+  constexpr auto hash = nameof::type_hash<Long>();
+  switch (hash) {
+    case nameof::type_hash<SomeStruct>():
+      FAIL("unexpected type");
+      break;
+    case nameof::type_hash<Long>():
+      break;
+    default:
+      FAIL("unexpected type");
+      break;
+  }
+}
+
+TEST_CASE("nameof::type_id") {
+  constexpr auto id = nameof::type_id<SomeStruct>();
+  static_assert(id == nameof::type_id<const SomeStruct&>());
+  static_assert(id != nameof::type_id<Long>());
+  static_assert(id.hash() == nameof::type_hash<SomeStruct>());
+  REQUIRE(id.name() == nameof::nameof_type<SomeStruct>());
+  REQUIRE(id.name().data() == nameof::nameof_type<SomeStruct>().data());
+  REQUIRE(std::hash<nameof::type_index>{}(id) == static_cast<std::size_t>(id.hash()));
+
+  // Same hash, different names.
+  constexpr auto collision_a = nameof::type_index{42, "A"};
+  constexpr auto collision_b = nameof::type_index{42, "B"};
+  static_assert(collision_a != collision_b);
+  static_assert(collision_a < collision_b);
+  static_assert(collision_a == nameof::type_index{42, "A"});
+
+  const auto lhs = nameof::type_id<SomeStruct>();
+  const auto rhs = nameof::type_id<Long>();
+  REQUIRE((lhs < rhs) != (rhs < lhs));
+  REQUIRE((lhs <= rhs) == !(lhs > rhs));
+  REQUIRE(lhs >= lhs);
+}
+
 TEST_CASE("NAMEOF_TYPE") {
   constexpr auto type_name = NAMEOF_TYPE(decltype(struct_var));
 #if defined(__clang__)
@@ -1457,12 +1919,80 @@ TEST_CASE("NAMEOF_TYPE_RTTI demangle success") {
 TEST_CASE("NAMEOF_TYPE_RTTI demangle fallback") {
   require_string_contract(nameof::detail::nameof_type_rtti<void>("not_a_mangled_type"), "not_a_mangled_type");
   require_string_contract(nameof::detail::nameof_full_type_rtti<const int&>("not_a_mangled_type"), "const not_a_mangled_type&");
+  require_string_contract(nameof::detail::nameof_full_type_rtti<const volatile int&&>("not_a_mangled_type"), "volatile const not_a_mangled_type&&");
+  require_string_contract(nameof::detail::nameof_full_type_rtti<int>("not_a_mangled_type"), "not_a_mangled_type");
   require_string_contract(nameof::detail::nameof_short_type_rtti<void>("some_namespace::not_a_mangled_type"), "not_a_mangled_type");
 }
 #endif
 
 #endif
 
+namespace TestNamed {
+struct Shape : nameof::named<Shape> {};
+struct Circle : nameof::named<Circle, Shape> {
+  explicit Circle(int r) : radius{r} {}
+  int radius;
+};
+} // namespace TestNamed
+
+TEST_CASE("NAMEOF_TYPE_DYNAMIC") {
+  TestNamed::Circle circle{1};
+  const TestNamed::Shape& shape = circle;
+  const nameof::named_base* base = &circle;
+  REQUIRE(shape.dynamic_type_name() == nameof::nameof_type<TestNamed::Circle>());
+  REQUIRE(base->dynamic_short_type_name() == "Circle");
+  REQUIRE(NAMEOF_TYPE_DYNAMIC(shape) == "TestNamed::Circle");
+  REQUIRE(NAMEOF_SHORT_TYPE_DYNAMIC(*base) == "Circle");
+  REQUIRE(NAMEOF_SHORT_TYPE_DYNAMIC(TestNamed::Shape{}) == "Shape");
+  static_assert(std::is_same_v<decltype(NAMEOF_TYPE_DYNAMIC(shape)), nameof::string_view>);
+
+#if defined(NAMEOF_TYPE_RTTI_SUPPORTED) && NAMEOF_TYPE_RTTI_SUPPORTED
+  TestRtti::Derived object;
+  const TestRtti::Base& ref = object;
+  REQUIRE(NAMEOF_SHORT_TYPE_DYNAMIC(ref) == "Derived");
+  static_assert(std::is_same_v<decltype(NAMEOF_TYPE_DYNAMIC(ref)), nameof::string>);
+#endif
+}
+
+#if defined(__cpp_lib_memory_resource)
+TEST_CASE("pmr") {
+  char storage[1024];
+  std::pmr::monotonic_buffer_resource resource{storage, sizeof(storage), std::pmr::null_memory_resource()};
+
+  const auto str = nameof::nameof_type<SomeStruct>().str(&resource);
+  REQUIRE(str == "SomeStruct");
+  REQUIRE(str.get_allocator().resource() == &resource);
+  REQUIRE(nameof::cstring<0>{}.str(&resource).empty());
+
+#  if defined(NAMEOF_ENUM_SUPPORTED) && NAMEOF_ENUM_SUPPORTED
+  const auto name = nameof::nameof_enum_or(Color::RED, "fallback", &resource);
+  const auto fallback = nameof::nameof_enum_or(OutOfRange::too_low, "fallback", &resource);
+  REQUIRE(name == "RED");
+  REQUIRE(fallback == "fallback");
+  REQUIRE(fallback.get_allocator().resource() == &resource);
+
+  const auto flags = nameof::nameof_enum_flag(static_cast<AnimalFlags>(HasClaws | CanFly), '|', &resource);
+  REQUIRE(flags == "HasClaws|CanFly");
+  REQUIRE(flags.get_allocator().resource() == &resource);
+  REQUIRE(nameof::nameof_enum_flag(static_cast<AnimalFlags>(0), '|', &resource).empty());
+  REQUIRE(nameof::nameof_enum_flag(static_cast<AnimalFlags>(0xF0), '|', &resource).empty());
+#  endif
+
+#  if defined(NAMEOF_TYPE_RTTI_SUPPORTED) && NAMEOF_TYPE_RTTI_SUPPORTED
+  TestRtti::Derived object;
+  const TestRtti::Base& ref = object;
+  const auto type = NAMEOF_TYPE_RTTI_PMR(&resource, ref);
+  const auto full_type = NAMEOF_FULL_TYPE_RTTI_PMR(&resource, ref);
+  const auto short_type = NAMEOF_SHORT_TYPE_RTTI_PMR(&resource, ref);
+  REQUIRE(type == NAMEOF_TYPE_RTTI(ref));
+  REQUIRE(full_type == NAMEOF_FULL_TYPE_RTTI(ref));
+  REQUIRE(short_type == NAMEOF_SHORT_TYPE_RTTI(ref));
+  REQUIRE(full_type.get_allocator().resource() == &resource);
+  REQUIRE(nameof::detail::nameof_full_type_rtti<const int&>("not_a_mangled_type", &resource) == "const not_a_mangled_type&");
+#  endif
+}
+#endif
+
 #if defined(NAMEOF_MEMBER_SUPPORTED) && NAMEOF_MEMBER_SUPPORTED
 
 struct StructMemberInitializationUsingNameof {
@@ -1508,6 +2038,59 @@ TEST_CASE("string_view_regression") {
 
 #endif
 
+#if defined(NAMEOF_MEMBERS_SUPPORTED) && NAMEOF_MEMBERS_SUPPORTED
+
+struct EmptyAggregate {};
+
+struct MembersAggregate {
+  int id = 0;
+  std::string name_1;
+  Long::LL nested;
+  const char* _ptr = nullptr;
+};
+
+struct OptionalAggregate {
+  int id = 0;
+  std::optional<int> value;
+  std::string label;
+};
+
+struct WideAggregate {
+  int f0, f1, f2, f3, f4, f5, f6, f7, f8, f9, f10, f11, f12, f13, f14, f15;
+  int f16, f17, f18, f19, f20, f21, f22, f23, f24, f25, f26, f27, f28, f29, f30, f31;
+  int f32, f33, f34, f35, f36, f37, f38, f39, f40, f41, f42, f43, f44, f45, f46, f47;
+  int f48, f49, f50, f51, f52, f53, f54, f55, f56, f57, f58, f59, f60, f61, f62, f63;
+};
+
+TEST_CASE("nameof_members") {
+  constexpr auto& members = nameof::nameof_members<MembersAggregate>();
+  static_assert(members.size() == 4);
+  static_assert(members[0] == "id");
+  REQUIRE(members[1] == "name_1");
+  REQUIRE(members[2] == "nested");
+  REQUIRE(members[3] == "_ptr");
+  require_string_view_contract(members[3], "_ptr");
+  REQUIRE(&nameof::nameof_members<const MembersAggregate&>() == &members);
+
+  static_assert(nameof::nameof_members<EmptyAggregate>().empty());
+  static_assert(nameof::nameof_members<SomeStruct>().size() == 1);
+  REQUIRE(nameof::nameof_members<SomeStruct>()[0] == "somefield");
+  REQUIRE(nameof::nameof_members<Long>()[0] == "ll");
+  REQUIRE(nameof::nameof_members<HiddenStruct>()[0] == "hidden_field");
+
+  constexpr auto& wide = nameof::nameof_members<WideAggregate>();
+  static_assert(wide.size() == 64);
+  REQUIRE(wide[0] == "f0");
+  REQUIRE(wide[63] == "f63");
+
+  constexpr auto& optional = nameof::nameof_members<OptionalAggregate>();
+  static_assert(optional.size() == 3);
+  REQUIRE(optional[1] == "value");
+  REQUIRE(optional[2] == "label");
+}
+
+#endif
+
 #if defined(NAMEOF_POINTER_SUPPORTED) && NAMEOF_POINTER_SUPPORTED
 
 void somefunction() {}
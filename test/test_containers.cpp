@@ -0,0 +1,207 @@
+// Licensed under the MIT License <http://opensource.org/licenses/MIT>.
+// SPDX-License-Identifier: MIT
+// Copyright (c) 2026 Daniil Goncharov <neargye@gmail.com>.
+//
+// Permission is hereby  granted, free of charge, to any  person obtaining a copy
+// of this software and associated  documentation files (the "Software"), to deal
+// in the Software  without restriction, including without  limitation the rights
+// to  use, copy,  modify, merge,  publish, distribute,  sublicense, and/or  sell
+// copies  of  the Software,  and  to  permit persons  to  whom  the Software  is
+// furnished to do so, subject to the following conditions:
+//
+// The above copyright notice and this permission notice shall be included in all
+// copies or substantial portions of the Software.
+//
+// THE SOFTWARE  IS PROVIDED "AS  IS", WITHOUT WARRANTY  OF ANY KIND,  EXPRESS OR
+// IMPLIED,  INCLUDING BUT  NOT  LIMITED TO  THE  WARRANTIES OF  MERCHANTABILITY,
+// FITNESS FOR  A PARTICULAR PURPOSE AND  NONINFRINGEMENT. IN NO EVENT  SHALL THE
+// AUTHORS  OR COPYRIGHT  HOLDERS  BE  LIABLE FOR  ANY  CLAIM,  DAMAGES OR  OTHER
+// LIABILITY, WHETHER IN AN ACTION OF  CONTRACT, TORT OR OTHERWISE, ARISING FROM,
+// OUT OF OR IN CONNECTION WITH THE SOFTWARE  OR THE USE OR OTHER DEALINGS IN THE
+// SOFTWARE.
+
+
+#define DOCTEST_CONFIG_IMPLEMENT_WITH_MAIN
+#include <doctest/doctest.h>
+
+#include <nameof_containers.hpp>
+
+#include <algorithm>
+#include <string>
+#include <thread>
+#include <vector>
+
+enum class Opcode { Nop, Load, Store, Jump = 10 };
+
+TEST_CASE("enum_counter") {
+  nameof::enum_counter<Opcode> counter;
+  REQUIRE(counter.total() == 0);
+
+  counter.increment(Opcode::Load);
+  counter.add(Opcode::Jump, 5);
+  counter.add(static_cast<Opcode>(3), 2);
+  REQUIRE(counter.count(Opcode::Nop) == 0);
+  REQUIRE(counter.count(Opcode::Load) == 1);
+  REQUIRE(counter.count(Opcode::Jump) == 5);
+  REQUIRE(counter.count(static_cast<Opcode>(42)) == 2);
+  REQUIRE(counter.unknown() == 2);
+  REQUIRE(counter.total() == 8);
+
+  const auto snapshot = counter.snapshot();
+  REQUIRE(snapshot.size() == 4);
+  REQUIRE(snapshot[1].first == "Load");
+  REQUIRE(snapshot[1].second == 1);
+  REQUIRE(snapshot[3].first == "Jump");
+  REQUIRE(snapshot[3].second == 5);
+
+  std::string names;
+  std::uint64_t sum = 0;
+  counter.for_each([&](Opcode, nameof::string_view name, std::uint64_t count) {
+    names.append(name.data(), name.size()).append(1, ',');
+    sum += count;
+  });
+  REQUIRE(names == "Nop,Load,Store,Jump,");
+  REQUIRE(sum == 6);
+
+  counter.reset();
+  REQUIRE(counter.total() == 0);
+}
+
+TEST_CASE("enum_counter threads") {
+  constexpr int threads_count = 8;
+  constexpr int iterations = 10000;
+  nameof::enum_counter<Opcode, 4> counter;
+
+  std::vector<std::thread> threads;
+  for (int t = 0; t < threads_count; ++t) {
+    threads.emplace_back([&counter, t] {
+      for (int i = 0; i < iterations; ++i) {
+        counter.increment(t % 2 == 0 ? Opcode::Store : Opcode::Nop);
+      }
+    });
+  }
+  for (auto& thread : threads) {
+    thread.join();
+  }
+
+  REQUIRE(counter.count(Opcode::Store) == threads_count / 2 * iterations);
+  REQUIRE(counter.count(Opcode::Nop) == threads_count / 2 * iterations);
+  REQUIRE(counter.total() == threads_count * iterations);
+}
+
+enum class Tile : std::uint8_t { Grass, Water, Sand, Rock, Snow, Lava, Ice, Mud, Swamp, Road, Wall, Void };
+
+TEST_CASE("packed_enum_vector") {
+  using vector = nameof::packed_enum_vector<Tile>;
+  static_assert(vector::bits_per_value == 4);
+  static_assert(vector::values_per_word == 16);
+  static_assert(nameof::packed_enum_vector<Opcode>::bits_per_value == 2);
+
+  vector tiles;
+  REQUIRE(tiles.empty());
+  REQUIRE(tiles.push_back(Tile::Water));
+  REQUIRE(tiles.push_back(Tile::Void));
+  REQUIRE_FALSE(tiles.push_back(static_cast<Tile>(42)));
+  REQUIRE(tiles.size() == 2);
+  REQUIRE(tiles[0] == Tile::Water);
+  REQUIRE(tiles[1] == Tile::Void);
+  REQUIRE(tiles.name(1) == "Void");
+
+  REQUIRE(tiles.set(0, Tile::Lava));
+  REQUIRE_FALSE(tiles.set(1, static_cast<Tile>(42)));
+  REQUIRE(tiles[0] == Tile::Lava);
+  REQUIRE(tiles[1] == Tile::Void);
+
+  std::string names;
+  tiles.for_each([&names](Tile, nameof::string_view name) { names.append(name.data(), name.size()).append(1, ','); });
+  REQUIRE(names == "Lava,Void,");
+
+  tiles.clear();
+  REQUIRE(tiles.empty());
+}
+
+TEST_CASE("packed_enum_vector pack and unpack") {
+  std::vector<Opcode> values;
+  for (int i = 0; i < 100; ++i) {
+    values.push_back(i % 3 == 0 ? Opcode::Jump : static_cast<Opcode>(i % 3));
+  }
+
+  nameof::packed_enum_vector<Opcode> opcodes;
+  opcodes.push_back(Opcode::Nop);
+  REQUIRE(opcodes.pack(values.data(), values.size()) == values.size());
+  REQUIRE(opcodes.size() == 101);
+  REQUIRE(opcodes.memory_size() == 4 * sizeof(std::uint64_t));
+
+  std::vector<Opcode> unpacked(values.size());
+  opcodes.unpack(1, unpacked.size(), unpacked.data());
+  REQUIRE(unpacked == values);
+
+  std::vector<Opcode> iterated(opcodes.begin(), opcodes.end());
+  REQUIRE(iterated.size() == 101);
+  REQUIRE(iterated.front() == Opcode::Nop);
+  REQUIRE(std::equal(values.begin(), values.end(), iterated.begin() + 1));
+
+  std::vector<Opcode> tail(5);
+  opcodes.unpack(96, 5, tail.data());
+  REQUIRE(std::equal(tail.begin(), tail.end(), values.end() - 5));
+}
+
+TEST_CASE("packed_enum_vector pack rejects unknown values") {
+  std::vector<Opcode> values(70, Opcode::Store);
+  values[40] = static_cast<Opcode>(5);
+
+  nameof::packed_enum_vector<Opcode> opcodes;
+  REQUIRE(opcodes.pack(values.data(), values.size()) == 40);
+  REQUIRE(opcodes.size() == 40);
+  REQUIRE(std::all_of(opcodes.begin(), opcodes.end(), [](Opcode v) { return v == Opcode::Store; }));
+
+  const auto capacity = opcodes.capacity();
+  REQUIRE(opcodes.pack(values.data(), 40) == 40);
+  REQUIRE(opcodes.pack(values.data(), 20) == 20);
+  REQUIRE(opcodes.capacity() >= 2 * capacity);
+}
+
+enum class Baud : short { B300 = -1200, B1200 = 0, B9600 = 1200, B19200 = 2400 };
+
+template <>
+struct nameof::customize::enum_range<Baud> {
+  static constexpr int min = -1200;
+  static constexpr int max = 2400;
+};
+
+TEST_CASE("packed_enum_vector sparse values") {
+  std::vector<Opcode> opcodes{Opcode::Jump, Opcode::Nop, Opcode::Jump};
+  nameof::packed_enum_vector<Opcode> packed_opcodes;
+  REQUIRE(packed_opcodes.pack(opcodes.data(), opcodes.size()) == 3);
+  REQUIRE(packed_opcodes.name(0) == "Jump");
+  REQUIRE(std::equal(opcodes.begin(), opcodes.end(), packed_opcodes.begin()));
+
+  nameof::packed_enum_vector<Baud> bauds;
+  static_assert(nameof::packed_enum_vector<Baud>::bits_per_value == 2);
+  REQUIRE(bauds.push_back(Baud::B19200));
+  REQUIRE(bauds.push_back(Baud::B300));
+  REQUIRE(bauds.push_back(Baud::B9600));
+  REQUIRE_FALSE(bauds.push_back(static_cast<Baud>(600)));
+  REQUIRE_FALSE(bauds.push_back(static_cast<Baud>(3000)));
+  REQUIRE(bauds.size() == 3);
+  REQUIRE(bauds[0] == Baud::B19200);
+  REQUIRE(bauds[1] == Baud::B300);
+  REQUIRE(bauds.name(2) == "B9600");
+}
+
+TEST_CASE("enum_counter sparse values") {
+  static_assert(nameof::detail::is_sparse_v<Opcode>);
+  static_assert(!nameof::detail::is_range_table_v<Baud>);
+
+  nameof::enum_counter<Baud, 2> counter;
+  counter.increment(Baud::B300);
+  counter.add(Baud::B19200, 3);
+  counter.increment(static_cast<Baud>(600));
+  REQUIRE(counter.count(Baud::B300) == 1);
+  REQUIRE(counter.count(Baud::B1200) == 0);
+  REQUIRE(counter.count(Baud::B19200) == 3);
+  REQUIRE(counter.unknown() == 1);
+  REQUIRE(counter.total() == 5);
+  REQUIRE(counter.snapshot()[3].first == "B19200");
+  REQUIRE(counter.snapshot()[3].second == 3);
+}
@@ -0,0 +1,194 @@
+// Licensed under the MIT License <http://opensource.org/licenses/MIT>.
+// SPDX-License-Identifier: MIT
+// Copyright (c) 2026 Daniil Goncharov <neargye@gmail.com>.
+//
+// Permission is hereby  granted, free of charge, to any  person obtaining a copy
+// of this software and associated  documentation files (the "Software"), to deal
+// in the Software  without restriction, including without  limitation the rights
+// to  use, copy,  modify, merge,  publish, distribute,  sublicense, and/or  sell
+// copies  of  the Software,  and  to  permit persons  to  whom  the Software  is
+// furnished to do so, subject to the following conditions:
+//
+// The above copyright notice and this permission notice shall be included in all
+// copies or substantial portions of the Software.
+//
+// THE SOFTWARE  IS PROVIDED "AS  IS", WITHOUT WARRANTY  OF ANY KIND,  EXPRESS OR
+// IMPLIED,  INCLUDING BUT  NOT  LIMITED TO  THE  WARRANTIES OF  MERCHANTABILITY,
+// FITNESS FOR  A PARTICULAR PURPOSE AND  NONINFRINGEMENT. IN NO EVENT  SHALL THE
+// AUTHORS  OR COPYRIGHT  HOLDERS  BE  LIABLE FOR  ANY  CLAIM,  DAMAGES OR  OTHER
+// LIABILITY, WHETHER IN AN ACTION OF  CONTRACT, TORT OR OTHERWISE, ARISING FROM,
+// OUT OF OR IN CONNECTION WITH THE SOFTWARE  OR THE USE OR OTHER DEALINGS IN THE
+// SOFTWARE.
+
+
+#define DOCTEST_CONFIG_IMPLEMENT_WITH_MAIN
+#include <doctest/doctest.h>
+
+#include <nameof_registry.hpp>
+
+#include <atomic>
+#include <csignal>
+#include <stdexcept>
+#include <string_view>
+#include <thread>
+
+enum class State { Idle, Running, Crashed };
+
+struct Task {
+  virtual ~Task() = default;
+};
+
+namespace jobs {
+struct Download : Task {};
+struct Upload : Task {};
+} // namespace jobs
+
+#if defined(NAMEOF_POINTER_SUPPORTED) && NAMEOF_POINTER_SUPPORTED
+namespace handlers {
+int on_connect(int fd) { return fd + 1; }
+int on_close(int fd) { return fd - 1; }
+void on_timeout() {}
+void on_unknown() {}
+int on_reset(int fd) { return fd * 2; }
+int on_flush(int fd) { return fd * 3; }
+int on_drain(int fd) { return fd * 4; }
+} // namespace handlers
+
+NAMEOF_REGISTER_FUNCTIONS(handlers::on_connect, handlers::on_close);
+NAMEOF_REGISTER_FUNCTIONS(&handlers::on_timeout);
+
+TEST_CASE("nameof_pointer registered functions") {
+  int (*callbacks[])(int) = {handlers::on_close, handlers::on_connect};
+  REQUIRE(nameof::nameof_pointer(callbacks[0]) == "on_close");
+  REQUIRE(nameof::nameof_pointer(callbacks[1]) == "on_connect");
+  REQUIRE(nameof::nameof_pointer(&handlers::on_timeout) == "on_timeout");
+  REQUIRE(nameof::nameof_pointer(&handlers::on_unknown).empty());
+
+  const auto* before = nameof::detail::function_names.load();
+  nameof::register_function_names<&handlers::on_unknown, &handlers::on_timeout>();
+  REQUIRE(nameof::nameof_pointer(&handlers::on_unknown) == "on_unknown");
+  REQUIRE(nameof::nameof_pointer(&handlers::on_timeout) == "on_timeout");
+  REQUIRE(nameof::nameof_pointer<&handlers::on_unknown>() == "on_unknown");
+
+  const auto* table = nameof::detail::function_names.load();
+  REQUIRE(table != before);
+  REQUIRE(table->retired == before);
+  REQUIRE(before->entries.size() == 3);
+  REQUIRE(table->entries.size() == 4);
+  for (std::size_t i = 1; i < table->entries.size(); ++i) {
+    REQUIRE(table->entries[i - 1].address < table->entries[i].address);
+  }
+}
+
+TEST_CASE("nameof_pointer concurrent registration") {
+  std::atomic<bool> done{false};
+  bool found = true;
+  std::thread reader{[&done, &found] {
+    while (!done.load()) {
+      found = found && nameof::nameof_pointer(&handlers::on_connect) == "on_connect";
+    }
+  }};
+  nameof::register_function_names<&handlers::on_reset, &handlers::on_flush>();
+  nameof::register_function_names<&handlers::on_drain>();
+  done.store(true);
+  reader.join();
+  REQUIRE(found);
+  REQUIRE(nameof::nameof_pointer(&handlers::on_drain) == "on_drain");
+}
+#endif
+
+#if defined(NAMEOF_TYPE_RTTI_SUPPORTED) && NAMEOF_TYPE_RTTI_SUPPORTED
+TEST_CASE("registered_type_name") {
+  REQUIRE(nameof::register_type_names<jobs::Download, State>());
+  REQUIRE(nameof::register_type_name(typeid(jobs::Download)));
+
+  jobs::Download download;
+  const Task& task = download;
+#  if defined(_MSC_VER)
+  REQUIRE(NAMEOF_TYPE_RTTI_REGISTERED(task) == "struct jobs::Download");
+  REQUIRE(nameof::registered_type_name(typeid(State)) == "enum State");
+#  else
+  REQUIRE(NAMEOF_TYPE_RTTI_REGISTERED(task) == "jobs::Download");
+  REQUIRE(nameof::registered_type_name(typeid(State)) == "State");
+#  endif
+  REQUIRE(nameof::registered_type_name(typeid(jobs::Upload)) == typeid(jobs::Upload).name());
+}
+
+#if __has_include(<cxxabi.h>)
+namespace errors {
+struct overload : std::runtime_error {
+  using std::runtime_error::runtime_error;
+};
+} // namespace errors
+
+TEST_CASE("nameof_current_exception_type") {
+  REQUIRE(nameof::nameof_current_exception_type().empty());
+
+  const char* first = nullptr;
+  for (int i = 0; i < 3; ++i) {
+    try {
+      throw errors::overload{"storm"};
+    } catch (...) {
+      const auto name = nameof::nameof_current_exception_type();
+      REQUIRE(name == "errors::overload");
+      REQUIRE(nameof::nameof_short_current_exception_type() == "overload");
+      if (first == nullptr) {
+        first = name.data();
+      }
+      REQUIRE(name.data() == first);
+    }
+  }
+
+  try {
+    throw 42;
+  } catch (...) {
+    REQUIRE(nameof::nameof_current_exception_type() == "int");
+  }
+  REQUIRE(nameof::registered_type_name(typeid(errors::overload)) == typeid(errors::overload).name());
+}
+#endif
+
+namespace {
+
+volatile std::sig_atomic_t handled = 0;
+const Task* current_task = nullptr;
+State current_state = State::Idle;
+char report[128] = {};
+
+void append(std::size_t& size, std::string_view str) noexcept {
+  for (std::size_t i = 0; i < str.size() && size + 1 < sizeof(report); ++i) {
+    report[size++] = str[i];
+  }
+}
+
+extern "C" void crash_handler(int) {
+  std::size_t size = 0;
+  append(size, nameof::nameof_enum(current_state));
+  append(size, " ");
+  append(size, NAMEOF_TYPE_RTTI_REGISTERED(*current_task));
+  report[size] = '\0';
+  handled = 1;
+}
+
+} // namespace
+
+TEST_CASE("signal handler") {
+  REQUIRE(nameof::register_type_names<jobs::Upload>());
+
+  jobs::Upload upload;
+  current_task = &upload;
+  current_state = State::Crashed;
+
+  const auto previous = std::signal(SIGTERM, crash_handler);
+  REQUIRE(previous != SIG_ERR);
+  REQUIRE(std::raise(SIGTERM) == 0);
+  std::signal(SIGTERM, previous);
+
+  REQUIRE(handled == 1);
+#  if defined(_MSC_VER)
+  REQUIRE(std::string_view{report} == "Crashed struct jobs::Upload");
+#  else
+  REQUIRE(std::string_view{report} == "Crashed jobs::Upload");
+#  endif
+}
+#endif
@@ -0,0 +1,114 @@
+// Licensed under the MIT License <http://opensource.org/licenses/MIT>.
+// SPDX-License-Identifier: MIT
+// Copyright (c) 2026 Daniil Goncharov <neargye@gmail.com>.
+//
+// Permission is hereby  granted, free of charge, to any  person obtaining a copy
+// of this software and associated  documentation files (the "Software"), to deal
+// in the Software  without restriction, including without  limitation the rights
+// to  use, copy,  modify, merge,  publish, distribute,  sublicense, and/or  sell
+// copies  of  the Software,  and  to  permit persons  to  whom  the Software  is
+// furnished to do so, subject to the following conditions:
+//
+// The above copyright notice and this permission notice shall be included in all
+// copies or substantial portions of the Software.
+//
+// THE SOFTWARE  IS PROVIDED "AS  IS", WITHOUT WARRANTY  OF ANY KIND,  EXPRESS OR
+// IMPLIED,  INCLUDING BUT  NOT  LIMITED TO  THE  WARRANTIES OF  MERCHANTABILITY,
+// FITNESS FOR  A PARTICULAR PURPOSE AND  NONINFRINGEMENT. IN NO EVENT  SHALL THE
+// AUTHORS  OR COPYRIGHT  HOLDERS  BE  LIABLE FOR  ANY  CLAIM,  DAMAGES OR  OTHER
+// LIABILITY, WHETHER IN AN ACTION OF  CONTRACT, TORT OR OTHERWISE, ARISING FROM,
+// OUT OF OR IN CONNECTION WITH THE SOFTWARE  OR THE USE OR OTHER DEALINGS IN THE
+// SOFTWARE.
+
+
+#define DOCTEST_CONFIG_IMPLEMENT_WITH_MAIN
+#include <doctest/doctest.h>
+
+#define NAMEOF_TRACE_CAPACITY 8
+#include <nameof_trace.hpp>
+
+#include <string>
+#include <thread>
+#include <vector>
+
+enum class State { Idle, Connecting, Connected, Closed };
+enum class Event : std::int8_t { Timeout = -1, Data = 1 };
+
+TEST_CASE("enum_descriptor") {
+  constexpr auto& state = nameof::enum_descriptor_of<State>();
+  static_assert(state.size() == 4);
+  static_assert(state.name(1) == "Connecting");
+  static_assert(state.name(4).empty());
+  REQUIRE(state.type_name() == nameof::nameof_type<State>());
+
+  constexpr auto& event = nameof::enum_descriptor_of<Event>();
+  static_assert(event.name(nameof::detail::erase_value(Event::Timeout)) == "Timeout");
+  static_assert(&nameof::enum_descriptor_of<const Event&>() == &event);
+}
+
+TEST_CASE("trace") {
+  NAMEOF_TRACE(State::Connecting);
+  NAMEOF_TRACE(Event::Timeout);
+  nameof::trace(static_cast<State>(42));
+
+  std::string names;
+  std::uint64_t last = 0;
+  nameof::trace_for_each([&](const nameof::trace_entry& entry) {
+    names.append(entry.type_name().data(), entry.type_name().size()).append(1, ':');
+    names.append(entry.name().data(), entry.name().size()).append(1, ',');
+    REQUIRE(entry.timestamp >= last);
+    last = entry.timestamp;
+  });
+  REQUIRE(names == "State:Connecting,Event:Timeout,State:,");
+
+  for (int i = 0; i < 10; ++i) {
+    NAMEOF_TRACE(i % 2 == 0 ? State::Idle : State::Closed);
+  }
+  std::size_t count = 0;
+  nameof::trace_for_each([&count](const nameof::trace_entry& entry) {
+    REQUIRE(entry.name() == (count % 2 == 0 ? "Idle" : "Closed"));
+    ++count;
+  });
+  REQUIRE(count == NAMEOF_TRACE_CAPACITY);
+}
+
+TEST_CASE("trace threads") {
+  std::vector<std::thread> threads;
+  for (int t = 0; t < 4; ++t) {
+    threads.emplace_back([] {
+      nameof::trace_thread_init();
+      const auto* buffer = &nameof::detail::this_thread_trace_buffer();
+      NAMEOF_TRACE(State::Closed);
+      REQUIRE(&nameof::detail::this_thread_trace_buffer() == buffer);
+    });
+  }
+  for (auto& thread : threads) {
+    thread.join();
+  }
+
+  std::size_t closed = 0;
+  nameof::trace_for_each_thread([&closed](const nameof::trace_entry& entry) {
+    if (entry.value == 3 && entry.name() == "Closed") {
+      ++closed;
+    }
+  });
+  REQUIRE(closed >= 4);
+}
+
+TEST_CASE("trace reused buffer") {
+  const nameof::detail::trace_buffer* first = nullptr;
+  std::thread{[&first] {
+    NAMEOF_TRACE(State::Idle);
+    NAMEOF_TRACE(State::Idle);
+    first = &nameof::detail::this_thread_trace_buffer();
+  }}.join();
+
+  std::thread{[first] {
+    NAMEOF_TRACE(State::Connected);
+    REQUIRE(&nameof::detail::this_thread_trace_buffer() == first);
+
+    std::string names;
+    nameof::trace_for_each([&names](const nameof::trace_entry& entry) { names.append(entry.name().data(), entry.name().size()).append(1, ','); });
+    REQUIRE(names == "Connected,");
+  }}.join();
+}